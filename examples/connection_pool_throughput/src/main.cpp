@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Prints the number of connection checkouts per second for a growing number
+// of threads, with a single shard and with one shard per hardware thread.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <sqlite3.h>
+
+#include <sqlpp23/sqlite3/sqlite3.h>
+#include <sqlpp23/sqlpp23.h>
+
+namespace sql = ::sqlpp::sqlite3;
+
+namespace {
+// Number of checkouts per second with `thread_count` threads that check out
+// connections and return them right away.
+double measure_checkouts(const std::shared_ptr<sql::connection_config>& config,
+                         std::size_t shards,
+                         std::size_t thread_count) {
+  auto pool = sql::connection_pool{
+      config, sqlpp::connection_pool_options{.capacity = thread_count,
+                                             .shards = shards}};
+  // Open one connection per thread upfront.
+  {
+    auto connections = std::vector<sql::pooled_connection>{};
+    for (std::size_t i = 0; i < thread_count; ++i) {
+      connections.push_back(pool.get());
+    }
+  }
+
+  auto start = std::atomic<bool>{false};
+  auto stop = std::atomic<bool>{false};
+  auto checkouts = std::atomic<std::size_t>{0};
+  auto threads = std::vector<std::thread>{};
+  for (std::size_t i = 0; i < thread_count; ++i) {
+    threads.emplace_back([&] {
+      while (not start) {
+        std::this_thread::yield();
+      }
+      auto count = std::size_t{0};
+      while (not stop) {
+        auto db = pool.get(sqlpp::connection_check::none);
+        ++count;
+      }
+      checkouts += count;
+    });
+  }
+
+  const auto duration = std::chrono::milliseconds{200};
+  start = true;
+  std::this_thread::sleep_for(duration);
+  stop = true;
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return static_cast<double>(checkouts) /
+         std::chrono::duration<double>(duration).count();
+}
+}  // namespace
+
+int main() {
+  if (not sqlite3_threadsafe()) {
+    std::cerr << "SQLite3 is not thread-safe" << std::endl;
+    return 1;
+  }
+  try {
+    auto config = std::make_shared<sql::connection_config>();
+    config->path_to_database =
+        "file:testpoolthroughput?mode=memory&cache=shared";
+    config->flags =
+        SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_URI;
+
+    const auto max_threads = std::clamp(
+        std::size_t{std::thread::hardware_concurrency()}, std::size_t{1},
+        std::size_t{64});
+    std::cout << "threads, checkouts/s (1 shard), checkouts/s (" << max_threads
+              << " shards)\n";
+    for (auto thread_count = std::size_t{1}; thread_count <= max_threads;
+         thread_count *= 2) {
+      std::cout << thread_count << ", "
+                << measure_checkouts(config, 1, thread_count) << ", "
+                << measure_checkouts(config, max_threads, thread_count)
+                << '\n';
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
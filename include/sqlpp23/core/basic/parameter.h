@@ -27,6 +27,8 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <vector>
+
 #include <sqlpp23/core/detail/type_set.h>
 #include <sqlpp23/core/name/create_name_tag.h>
 #include <sqlpp23/core/operator/enable_as.h>
@@ -78,4 +80,53 @@ auto parameter(const DataType& /*unused*/, const NameTagProvider& /*unused*/)
     -> parameter_t<DataType, name_tag_of_t<NameTagProvider>> {
   return {};
 }
+
+// A parameter that is bound to a whole list of values at once, e.g. for
+// `tab.id.in(array_parameter(tab.id))`. The serialized statement does not
+// depend on the number of values. Elements are never NULL.
+template <typename DataType, typename NameTag>
+struct array_parameter_t {
+  using _instance_t = typename NameTag::template _member_t<
+      std::vector<parameter_value_t<DataType>>>;
+  array_parameter_t() = default;
+
+  array_parameter_t(const array_parameter_t&) = default;
+  array_parameter_t(array_parameter_t&&) = default;
+  array_parameter_t& operator=(const array_parameter_t&) = default;
+  array_parameter_t& operator=(array_parameter_t&&) = default;
+  ~array_parameter_t() = default;
+};
+
+// No data_type_of defined for array_parameter_t, because it is to be used with
+// in() and not_in(), only.
+
+template <typename DataType, typename NameTag>
+struct parameters_of<array_parameter_t<DataType, NameTag>> {
+  using type = detail::type_vector<array_parameter_t<DataType, NameTag>>;
+};
+
+template <typename Context, typename DataType, typename NameTag>
+auto to_sql_string(Context&, const array_parameter_t<DataType, NameTag>&)
+    -> std::string {
+  return "?";
+}
+
+template <typename NamedExpr>
+  requires(has_data_type<NamedExpr>::value and
+           has_name_tag<NamedExpr>::value)
+auto array_parameter(const NamedExpr& /*unused*/)
+    -> array_parameter_t<remove_optional_t<data_type_of_t<NamedExpr>>,
+                         name_tag_of_t<NamedExpr>> {
+  return {};
+}
+
+template <typename DataType, typename NameTagProvider>
+  requires((is_data_type<DataType>::value or has_data_type<DataType>::value) and
+           has_name_tag<NameTagProvider>::value)
+auto array_parameter(const DataType& /*unused*/,
+                     const NameTagProvider& /*unused*/)
+    -> array_parameter_t<remove_optional_t<DataType>,
+                         name_tag_of_t<NameTagProvider>> {
+  return {};
+}
 }  // namespace sqlpp
@@ -0,0 +1,498 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/basic/schema_qualified_table.h>
+#include <sqlpp23/core/basic/table.h>
+#include <sqlpp23/core/clause/select_as.h>
+#include <sqlpp23/core/database/parameter_list.h>
+#include <sqlpp23/core/database/read_only_statement.h>
+#include <sqlpp23/core/database/transaction.h>
+#include <sqlpp23/core/detail/type_set.h>
+#include <sqlpp23/core/detail/type_vector.h>
+#include <sqlpp23/core/query/materialized_result.h>
+#include <sqlpp23/core/query/statement.h>
+#include <sqlpp23/core/to_sql_string.h>
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp {
+struct query_cache_options {
+  // How long rows are served from the cache after they have been read.
+  std::chrono::milliseconds ttl = std::chrono::seconds{1};
+  // If the cache is full, expired entries are dropped first, then the entries
+  // that would expire next.
+  std::size_t max_entries = 1024;
+};
+
+namespace detail {
+// Names of the tables that a statement reads or writes, including the tables
+// of sub queries. `all` is set if a table cannot be named, e.g. a common table
+// expression or a verbatim table.
+struct cached_tables {
+  std::vector<std::string_view> names;
+  bool all = false;
+};
+
+template <typename Table>
+struct cached_table_name {
+  static void add(cached_tables& tables) { tables.all = true; }
+};
+
+template <typename TableSpec>
+struct cached_table_name<table_t<TableSpec>> {
+  static void add(cached_tables& tables) {
+    tables.names.push_back(name_tag_of_t<TableSpec>::name);
+  }
+};
+
+template <typename TableSpec, typename NameTag>
+struct cached_table_name<table_as_t<TableSpec, NameTag>>
+    : public cached_table_name<table_t<TableSpec>> {};
+
+template <typename TableSpec, typename NameTag>
+struct cached_table_name<schema_qualified_table_as_t<TableSpec, NameTag>>
+    : public cached_table_name<table_t<TableSpec>> {};
+
+// The tables of the sub select are found via its nodes.
+template <typename Select, typename NameTag, typename... FieldSpecs>
+struct cached_table_name<select_as_t<Select, NameTag, FieldSpecs...>> {
+  static void add(cached_tables&) {}
+};
+
+template <typename T>
+struct cached_tables_of;
+
+template <typename... T>
+void add_cached_tables(cached_tables& tables, type_vector<T...>) {
+  (cached_tables_of<T>::add(tables), ...);
+}
+
+template <typename... T>
+void add_provided_tables(cached_tables& tables, type_set<T...>) {
+  (cached_table_name<T>::add(tables), ...);
+}
+
+template <typename T>
+struct cached_tables_of {
+  static void add(cached_tables& tables) {
+    add_cached_tables(tables, nodes_of_t<T>{});
+  }
+};
+
+// Statements do not expose their clauses as nodes, see nodes_of.
+template <typename... Clauses>
+struct cached_tables_of<statement_t<Clauses...>> {
+  static void add(cached_tables& tables) {
+    add_provided_tables(
+        tables, typename statement_t<Clauses...>::_all_provided_tables{});
+    (cached_tables_of<Clauses>::add(tables), ...);
+  }
+};
+
+// Sorted and unique, computed once per statement type.
+template <typename Statement>
+const cached_tables& get_cached_tables() {
+  static const cached_tables tables = [] {
+    auto result = cached_tables{};
+    cached_tables_of<Statement>::add(result);
+    std::ranges::sort(result.names);
+    const auto duplicates = std::ranges::unique(result.names);
+    result.names.erase(duplicates.begin(), duplicates.end());
+    return result;
+  }();
+  return tables;
+}
+
+template <typename ResultRow>
+const void* cached_row_type() {
+  static constexpr char id = 0;
+  return &id;
+}
+
+template <typename Context, typename Value>
+void append_to_cache_key(std::string& key, Context& context,
+                         const Value& value) {
+  key += to_sql_string(context, value);
+  key.push_back('\0');
+}
+
+// Values of array parameters
+template <typename Context, typename Value>
+  requires(not std::is_same_v<Value, uint8_t>)
+void append_to_cache_key(std::string& key, Context& context,
+                         const std::vector<Value>& values) {
+  key.push_back('(');
+  for (const auto& value : values) {
+    append_to_cache_key(key, context, value);
+  }
+  key.push_back(')');
+}
+
+template <typename Context, typename... Parameter>
+void append_to_cache_key(
+    std::string& key, Context& context,
+    const parameter_list_t<type_vector<Parameter...>>& parameters) {
+  key.push_back('\0');
+  (append_to_cache_key(
+       key, context,
+       static_cast<const typename Parameter::_instance_t&>(parameters)()),
+   ...);
+}
+}  // namespace detail
+
+// Rows of selects, keyed by their SQL and parameter values. The cache is
+// thread-safe and can be shared by the caching_connections of a database.
+class query_cache {
+  using _clock_t = std::chrono::steady_clock;
+
+ public:
+  explicit query_cache(const query_cache_options& options = {})
+      : _options(options) {}
+
+  query_cache(const query_cache&) = delete;
+  query_cache(query_cache&&) = delete;
+  query_cache& operator=(const query_cache&) = delete;
+  query_cache& operator=(query_cache&&) = delete;
+  ~query_cache() = default;
+
+  // Returns nullptr if there are no valid rows for the key.
+  template <typename ResultRow>
+  std::shared_ptr<const materialized_result<ResultRow>> find(
+      const std::string& key) {
+    const std::lock_guard<std::mutex> lock{_mutex};
+    const auto it = _entries.find(key);
+    if (it == _entries.end()) {
+      return nullptr;
+    }
+    if (it->second.expires <= _clock_t::now() or
+        it->second.row_type != detail::cached_row_type<ResultRow>()) {
+      _entries.erase(it);
+      return nullptr;
+    }
+    return std::static_pointer_cast<const materialized_result<ResultRow>>(
+        it->second.rows);
+  }
+
+  // To be obtained before reading rows that are to be stored, see store().
+  std::uint64_t generation() const {
+    const std::lock_guard<std::mutex> lock{_mutex};
+    return _generation;
+  }
+
+  // Stores rows that have been read from the tables. The rows are dropped if
+  // the cache was invalidated after `generation` was obtained, as they might
+  // be outdated.
+  template <typename ResultRow>
+  void store(std::string key,
+             const detail::cached_tables& tables,
+             std::uint64_t generation,
+             std::shared_ptr<const materialized_result<ResultRow>> rows) {
+    const std::lock_guard<std::mutex> lock{_mutex};
+    if (generation != _generation or _options.max_entries == 0) {
+      return;
+    }
+    const auto now = _clock_t::now();
+    if (_entries.size() >= _options.max_entries and
+        not _entries.contains(key)) {
+      make_room(now);
+    }
+    _entries.insert_or_assign(
+        std::move(key),
+        entry{std::move(rows), detail::cached_row_type<ResultRow>(), &tables,
+              now + _options.ttl});
+  }
+
+  // Drops the entries that read from the table, e.g. after it was changed by
+  // other means than a caching_connection.
+  void invalidate(std::string_view table) {
+    const std::lock_guard<std::mutex> lock{_mutex};
+    ++_generation;
+    std::erase_if(_entries, [&](const auto& e) {
+      return e.second.tables->all or
+             std::ranges::binary_search(e.second.tables->names, table);
+    });
+  }
+
+  // Drops the entries that read from any of the tables.
+  void invalidate(const detail::cached_tables& tables) {
+    if (tables.all or tables.names.empty()) {
+      clear();
+      return;
+    }
+    const std::lock_guard<std::mutex> lock{_mutex};
+    ++_generation;
+    std::erase_if(_entries, [&](const auto& e) {
+      return e.second.tables->all or
+             std::ranges::any_of(tables.names, [&](std::string_view table) {
+               return std::ranges::binary_search(e.second.tables->names,
+                                                 table);
+             });
+    });
+  }
+
+  void clear() {
+    const std::lock_guard<std::mutex> lock{_mutex};
+    ++_generation;
+    _entries.clear();
+  }
+
+  // Includes expired entries that have not been dropped yet.
+  std::size_t size() const {
+    const std::lock_guard<std::mutex> lock{_mutex};
+    return _entries.size();
+  }
+
+ private:
+  struct entry {
+    std::shared_ptr<const void> rows;
+    const void* row_type;
+    const detail::cached_tables* tables;
+    _clock_t::time_point expires;
+  };
+
+  void make_room(_clock_t::time_point now) {
+    std::erase_if(_entries, [&](const auto& e) {
+      return e.second.expires <= now;
+    });
+    if (_entries.size() >= _options.max_entries) {
+      _entries.erase(std::ranges::min_element(_entries, {}, [](const auto& e) {
+        return e.second.expires;
+      }));
+    }
+  }
+
+  const query_cache_options _options;
+  mutable std::mutex _mutex;
+  std::unordered_map<std::string, entry> _entries;
+  // Incremented by each invalidation.
+  std::uint64_t _generation = 0;
+};
+
+// Rows of a select, served by a caching_connection. The rows are shared with
+// the cache and stay valid as long as the cached_result exists.
+template <typename ResultRow>
+class cached_result {
+ public:
+  using iterator = typename materialized_result<ResultRow>::const_iterator;
+
+  explicit cached_result(
+      std::shared_ptr<const materialized_result<ResultRow>> rows)
+      : _rows(std::move(rows)) {}
+
+  iterator begin() const {
+    return _rows->begin() + static_cast<std::ptrdiff_t>(_offset);
+  }
+
+  iterator end() const { return _rows->end(); }
+
+  std::size_t size() const { return _rows->size() - _offset; }
+
+  bool empty() const { return size() == 0; }
+
+  const ResultRow& front() const { return (*_rows)[_offset]; }
+
+  void pop_front() { ++_offset; }
+
+ private:
+  std::shared_ptr<const materialized_result<ResultRow>> _rows;
+  std::size_t _offset = 0;
+};
+
+template <typename Connection>
+class caching_connection;
+
+// A prepared statement of a caching_connection. Parameters are set as usual.
+template <typename Prepared, typename Statement>
+class cached_prepared_statement_t : public Prepared {
+ public:
+  cached_prepared_statement_t(Prepared prepared, std::string sql)
+      : Prepared(std::move(prepared)), _sql(std::move(sql)) {}
+
+ private:
+  template <typename Connection>
+  friend class caching_connection;
+
+  std::string _sql;
+};
+
+// Wraps a connection. Selects without `for_update` are served from a
+// query_cache while the cached rows are valid. Other statements executed
+// through the caching_connection drop the cached rows of the tables they use.
+// Within a transaction, selects bypass the cache and the rows are dropped when
+// the transaction is committed, see start_transaction().
+template <typename Connection>
+class caching_connection {
+  using _context_t = typename Connection::_context_t;
+
+ public:
+  explicit caching_connection(
+      Connection connection,
+      std::shared_ptr<query_cache> cache = std::make_shared<query_cache>())
+      : _connection(std::move(connection)), _cache(std::move(cache)) {}
+
+  caching_connection(const caching_connection&) = delete;
+  caching_connection(caching_connection&&) = default;
+  caching_connection& operator=(const caching_connection&) = delete;
+  caching_connection& operator=(caching_connection&&) = default;
+  ~caching_connection() = default;
+
+  template <typename T>
+    requires(is_statement_v<T>)
+  auto operator()(const T& t) {
+    if constexpr (is_read_only_statement_v<T>) {
+      _context_t context{&_connection};
+      return select(to_sql_string(context, t), detail::get_cached_tables<T>(),
+                    [&] { return _connection(t); });
+    } else {
+      auto result = _connection(t);
+      invalidate(detail::get_cached_tables<T>());
+      return result;
+    }
+  }
+
+  template <typename Prepared, typename Statement>
+  auto operator()(cached_prepared_statement_t<Prepared, Statement>& p) {
+    if constexpr (is_read_only_statement_v<Statement>) {
+      auto key = p._sql;
+      _context_t context{&_connection};
+      detail::append_to_cache_key(key, context, p.parameters);
+      return select(std::move(key), detail::get_cached_tables<Statement>(),
+                    [&] { return _connection(static_cast<Prepared&>(p)); });
+    } else {
+      auto result = _connection(static_cast<Prepared&>(p));
+      invalidate(detail::get_cached_tables<Statement>());
+      return result;
+    }
+  }
+
+  // The statement is not analyzed, all cached rows are dropped.
+  auto operator()(std::string_view statement) {
+    auto result = _connection(statement);
+    invalidate(detail::cached_tables{.names = {}, .all = true});
+    return result;
+  }
+
+  template <typename T>
+    requires(is_statement_v<T>)
+  auto prepare(const T& t) {
+    _context_t context{&_connection};
+    auto sql = to_sql_string(context, t);
+    return cached_prepared_statement_t<decltype(_connection.prepare(t)), T>{
+        _connection.prepare(t), std::move(sql)};
+  }
+
+  // Selects within the transaction may see uncommitted changes and are not
+  // cached. Other connections may cache the old rows of tables written within
+  // the transaction until it is committed, so these rows are dropped on commit.
+  void start_transaction() {
+    _connection.start_transaction();
+    _transaction_active = true;
+  }
+
+  void start_transaction(isolation_level level) {
+    _connection.start_transaction(level);
+    _transaction_active = true;
+  }
+
+  void commit_transaction() {
+    _connection.commit_transaction();
+    _transaction_active = false;
+    if (_written.all or not _written.names.empty()) {
+      _cache->invalidate(_written);
+    }
+    _written = {};
+  }
+
+  void rollback_transaction() {
+    _connection.rollback_transaction();
+    _transaction_active = false;
+    _written = {};
+  }
+
+  void report_rollback_failure(const std::string& message) noexcept {
+    _connection.report_rollback_failure(message);
+  }
+
+  bool is_transaction_active() const { return _transaction_active; }
+
+  // Statements executed directly on the connection, including transactions
+  // started there, do not invalidate cached rows.
+  Connection& connection() { return _connection; }
+
+  query_cache& cache() { return *_cache; }
+
+ private:
+  template <typename Run>
+  auto select(std::string key, const detail::cached_tables& tables, Run run) {
+    using _rows_t = decltype(run().materialize());
+    using _row_t = typename _rows_t::value_type;
+    if (_transaction_active) {
+      return cached_result<_row_t>{
+          std::make_shared<const _rows_t>(run().materialize())};
+    }
+    if (auto rows = _cache->template find<_row_t>(key)) {
+      return cached_result<_row_t>{std::move(rows)};
+    }
+    const auto generation = _cache->generation();
+    auto rows = std::make_shared<const _rows_t>(run().materialize());
+    _cache->store<_row_t>(std::move(key), tables, generation, rows);
+    return cached_result<_row_t>{std::move(rows)};
+  }
+
+  // Within a transaction, the tables are recorded for commit_transaction().
+  void invalidate(const detail::cached_tables& tables) {
+    if (not _transaction_active) {
+      _cache->invalidate(tables);
+      return;
+    }
+    _written.all = _written.all or tables.all or tables.names.empty();
+    for (const auto table : tables.names) {
+      if (std::ranges::find(_written.names, table) == _written.names.end()) {
+        _written.names.push_back(table);
+      }
+    }
+  }
+
+  Connection _connection;
+  std::shared_ptr<query_cache> _cache;
+  bool _transaction_active = false;
+  // Tables written within the current transaction.
+  detail::cached_tables _written;
+};
+}  // namespace sqlpp
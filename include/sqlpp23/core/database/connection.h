@@ -28,6 +28,8 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <utility>
 
@@ -112,25 +114,43 @@ class pooled_connection : public common_connection<ConnectionBase> {
       static_cast<ConnectionBase&>(*this) =
           std::move(static_cast<ConnectionBase&>(other));
       _pool_core = std::move(other._pool_core);
+      _created = other._created;
+      _acquired = other._acquired;
+      _checkout = other._checkout;
     }
     return *this;
   }
 
  private:
+  using _time_point_t = std::chrono::steady_clock::time_point;
+
   _pool_core_ptr_t _pool_core;
+  // When the underlying connection was opened.
+  _time_point_t _created;
+  // When the connection was taken from the pool.
+  _time_point_t _acquired;
+  // Set by the pool if checkouts are tracked.
+  std::uint64_t _checkout = 0;
 
   // Constructors used by the connection pool
-  pooled_connection(_handle_t&& handle, _pool_core_ptr_t pool_core)
+  pooled_connection(_handle_t&& handle,
+                    _time_point_t created,
+                    _time_point_t acquired,
+                    _pool_core_ptr_t pool_core)
       : common_connection<ConnectionBase>(std::move(handle)),
-        _pool_core(pool_core) {}
+        _pool_core(pool_core),
+        _created(created),
+        _acquired(acquired) {}
 
   pooled_connection(const _config_ptr_t& config, _pool_core_ptr_t pool_core)
       : common_connection<ConnectionBase>(_handle_t{config}),
-        _pool_core(pool_core) {}
+        _pool_core(pool_core),
+        _created(std::chrono::steady_clock::now()),
+        _acquired(_created) {}
 
   void conn_release() {
     if (_pool_core) {
-      _pool_core->put(ConnectionBase::_handle);
+      _pool_core->put(ConnectionBase::_handle, _created, _acquired, _checkout);
       _pool_core = nullptr;
     }
   }
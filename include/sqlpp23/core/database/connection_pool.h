@@ -28,15 +28,71 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp23/core/database/connection.h>
+#include <sqlpp23/core/database/connection_pool_stats.h>
+#include <sqlpp23/core/database/exception.h>
 #include <sqlpp23/core/detail/circular_buffer.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <source_location>
 #include <stdexcept>
+#include <stop_token>
+#include <thread>
+#include <vector>
 
 namespace sqlpp {
 enum class connection_check { none, passive, ping };
 
+struct connection_pool_options {
+  // Initial capacity of the cache of idle connections.
+  std::size_t capacity = 5;
+  // Maximum number of open connections (idle and in use), 0 for no limit.
+  std::size_t max_size = 0;
+  // Maximum time get() waits for a connection once max_size is reached.
+  std::chrono::milliseconds acquire_timeout = std::chrono::seconds{30};
+  // Number of idle connections opened when the pool is created and kept
+  // available by a background thread.
+  std::size_t min_idle = 0;
+  // Idle connections beyond min_idle are closed after this time, 0 for never.
+  std::chrono::milliseconds idle_timeout = std::chrono::milliseconds{0};
+  // Connections are closed once they are older than this, 0 for never.
+  std::chrono::milliseconds max_lifetime = std::chrono::milliseconds{0};
+  // Check applied to idle connections by the background thread.
+  connection_check idle_check = connection_check::none;
+  // Check applied by get() without arguments.
+  connection_check checkout_check = connection_check::passive;
+  // Close all idle connections if a connection fails the check in get(), e.g.
+  // to move to a new primary quickly after a failover.
+  bool clear_idle_on_failed_check = false;
+  // Connections held longer than this are reported to on_leak (once per
+  // checkout, by the background thread), 0 to disable.
+  std::chrono::milliseconds leak_threshold = std::chrono::milliseconds{0};
+  std::function<void(const held_connection&)> on_leak = {};
+  // Record connection time per call site of get(), see call_sites().
+  bool track_call_sites = false;
+  // Number of separately locked lists of idle connections. Threads prefer
+  // their own list, which reduces lock contention with many threads.
+  std::size_t shards = 1;
+  // How often the background thread checks the pool.
+  std::chrono::milliseconds maintenance_interval = std::chrono::seconds{1};
+};
+
+// Thrown by connection_pool::get() if no connection became available within
+// the acquire timeout.
+class connection_pool_timeout : public exception {
+ public:
+  using exception::exception;
+};
+
 template <typename ConnectionBase>
 class connection_pool {
  public:
@@ -46,8 +102,23 @@ class connection_pool {
 
   class pool_core : public std::enable_shared_from_this<pool_core> {
    public:
+    using _clock_t = std::chrono::steady_clock;
+
+    pool_core(const _config_ptr_t& connection_config,
+              const connection_pool_options& options)
+        : _connection_config{connection_config},
+          _options{options},
+          _shard_count{std::max(options.shards, std::size_t{1})},
+          _shards{std::make_unique<shard[]>(_shard_count)} {
+      for (std::size_t i = 0; i < _shard_count; ++i) {
+        _shards[i].handles.set_capacity(
+            (options.capacity + _shard_count - 1) / _shard_count);
+      }
+    }
+
     pool_core(const _config_ptr_t& connection_config, std::size_t capacity)
-        : _connection_config{connection_config}, _handles{capacity} {}
+        : pool_core{connection_config,
+                    connection_pool_options{.capacity = capacity}} {}
 
     pool_core() = delete;
     pool_core(const pool_core&) = delete;
@@ -56,40 +127,378 @@ class connection_pool {
     pool_core& operator=(const pool_core&) = delete;
     pool_core& operator=(pool_core&&) = delete;
 
-    _pooled_connection_t get(connection_check check) {
-      std::unique_lock<std::mutex> lock{_mutex};
-      if (_handles.empty()) {
-        lock.unlock();
-        return _pooled_connection_t{_connection_config,
-                                    this->shared_from_this()};
-      }
-      auto handle = std::move(_handles.front());
-      _handles.pop_front();
-      lock.unlock();
-      // If the fetched connection is dead, drop it and create a new one on the
-      // fly
-      return check_connection(handle, check)
-                 ? _pooled_connection_t{std::move(handle),
-                                        this->shared_from_this()}
-                 : _pooled_connection_t{_connection_config,
-                                        this->shared_from_this()};
-    }
-
-    void put(_handle_t& handle) {
-      std::unique_lock<std::mutex> lock{_mutex};
-      if (_handles.full()) {
-        _handles.set_capacity(_handles.capacity() + 5);
+    _pooled_connection_t get(connection_check check,
+                             const std::source_location& location) {
+      const auto start = _clock_t::now();
+      auto idle = acquire();
+      if (idle) {
+        if (check_connection(idle->handle, check)) {
+          const auto now = _clock_t::now();
+          _counters.acquire_time.record(now - start);
+          return track(
+              _pooled_connection_t{std::move(idle->handle), idle->created,
+                                   now, this->shared_from_this()},
+              location);
+        }
+        // The fetched connection is dead. Drop it and create a new one on the
+        // fly
+        _counters.increment(_counters.failed_checks);
+        _counters.increment(_counters.closed);
+        if (_options.clear_idle_on_failed_check) {
+          clear_idle();
+        }
+      }
+      auto connection = open();
+      _counters.acquire_time.record(_clock_t::now() - start);
+      return track(std::move(connection), location);
+    }
+
+    void put(_handle_t& handle,
+             _clock_t::time_point created,
+             _clock_t::time_point acquired,
+             std::uint64_t checkout) {
+      auto idle = idle_connection{std::move(handle), created, _clock_t::now()};
+      _counters.held_time.record(idle.idle_since - acquired);
+      if (checkout != 0) {
+        _checkouts.untrack(checkout, idle.idle_since);
+      }
+      if (exceeds_max_lifetime(idle, idle.idle_since)) {
+        close(std::move(idle));
+        return;
       }
-      _handles.push_back(std::move(handle));
+      make_available(_shards[home_shard()], std::move(idle));
+    }
+
+    connection_pool_stats stats() const {
+      return _counters.snapshot(_waiting.load(std::memory_order_relaxed));
     }
 
     // Returns number of connections available in the pool. Only used in tests.
     std::size_t available() {
-      std::unique_lock<std::mutex> lock{_mutex};
-      return _handles.size();
+      auto count = std::size_t{0};
+      for (std::size_t i = 0; i < _shard_count; ++i) {
+        std::unique_lock<std::mutex> lock{_shards[i].mutex};
+        count += _shards[i].handles.size();
+      }
+      return count;
     }
 
+    // Opens connections in parallel until min_idle connections are idle
+    // (without exceeding max_size). Returns the first error, if any.
+    std::exception_ptr replenish() {
+      auto missing = std::size_t{0};
+      {
+        std::unique_lock<std::mutex> lock{_mutex};
+        const auto idle = available();
+        if (idle < _options.min_idle) {
+          missing = _options.min_idle - idle;
+        }
+        if (_options.max_size != 0) {
+          missing = std::min(missing, _options.max_size - _size);
+        }
+        _size += missing;
+      }
+
+      auto opening = open_handles(missing);
+
+      auto error = std::exception_ptr{};
+      for (std::size_t i = 0; i < opening.size(); ++i) {
+        try {
+          const auto now = _clock_t::now();
+          // Spread the new connections over the shards.
+          make_available(_shards[i % _shard_count],
+                         idle_connection{opening[i].get(), now, now});
+          _counters.increment(_counters.created);
+        } catch (...) {
+          _counters.increment(_counters.creation_failures);
+          release_slot();
+          if (not error) {
+            error = std::current_exception();
+          }
+        }
+      }
+      return error;
+    }
+
+    // Closes all idle connections.
+    void clear_idle() {
+      auto closing = std::vector<idle_connection>{};
+      for (std::size_t s = 0; s < _shard_count; ++s) {
+        std::unique_lock<std::mutex> lock{_shards[s].mutex};
+        while (not _shards[s].handles.empty()) {
+          closing.push_back(std::move(_shards[s].handles.front()));
+          _shards[s].handles.pop_front();
+          _counters.idle.fetch_sub(1, std::memory_order_relaxed);
+        }
+      }
+      for (auto& idle : closing) {
+        close(std::move(idle));
+      }
+    }
+
+    // Visits each idle connection once. Closes connections that exceeded
+    // max_lifetime, or idle_timeout while more than min_idle connections are
+    // idle, as well as connections failing the idle check.
+    void maintain() {
+      for (std::size_t s = 0; s < _shard_count; ++s) {
+        auto& current = _shards[s];
+        auto count = std::size_t{0};
+        {
+          std::unique_lock<std::mutex> lock{current.mutex};
+          count = current.handles.size();
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+          auto idle = idle_connection{};
+          {
+            std::unique_lock<std::mutex> lock{current.mutex};
+            if (current.handles.empty()) {
+              break;
+            }
+            idle = std::move(current.handles.front());
+            current.handles.pop_front();
+            _counters.idle.fetch_sub(1, std::memory_order_relaxed);
+          }
+          // Connections are closed and checked without holding a lock.
+          const auto now = _clock_t::now();
+          const auto expired =
+              exceeds_max_lifetime(idle, now) or
+              (_options.idle_timeout.count() > 0 and
+               now - idle.idle_since > _options.idle_timeout and
+               available() >= _options.min_idle);
+          if (expired) {
+            close(std::move(idle));
+            continue;
+          }
+          if (not check_connection(idle.handle, _options.idle_check)) {
+            _counters.increment(_counters.failed_checks);
+            close(std::move(idle));
+            continue;
+          }
+          make_available(current, std::move(idle));
+        }
+      }
+    }
+
+    // Reports connections held longer than leak_threshold.
+    void report_leaks() {
+      if (_options.leak_threshold.count() == 0 or not _options.on_leak) {
+        return;
+      }
+      for (const auto& held :
+           _checkouts.held_longer_than(_options.leak_threshold)) {
+        _options.on_leak(held);
+      }
+    }
+
+    std::vector<call_site_stats> call_sites() const {
+      return _checkouts.call_sites();
+    }
+
+    // Whether the pool needs a background thread.
+    bool needs_maintenance() const {
+      return _options.min_idle > 0 or _options.idle_timeout.count() > 0 or
+             _options.max_lifetime.count() > 0 or
+             _options.idle_check != connection_check::none or
+             _options.leak_threshold.count() > 0;
+    }
+
+    const connection_pool_options& options() const { return _options; }
+
    private:
+    struct idle_connection {
+      _handle_t handle;
+      _clock_t::time_point created;
+      _clock_t::time_point idle_since;
+    };
+
+    // Free list with its own lock. Aligned to avoid false sharing.
+    struct alignas(64) shard {
+      std::mutex mutex;
+      sqlpp::detail::circular_buffer<idle_connection> handles{0};
+    };
+
+    struct waiter {
+      std::condition_variable cv;
+      // Empty if the waiter is allowed to open a new connection.
+      std::optional<idle_connection> idle;
+      bool served = false;
+    };
+
+    _pooled_connection_t track(_pooled_connection_t connection,
+                               const std::source_location& location) {
+      if (_options.leak_threshold.count() > 0 or _options.track_call_sites) {
+        connection._checkout =
+            _checkouts.track(connection._acquired, location);
+      }
+      return connection;
+    }
+
+    // Opens connections concurrently. Connectors that can open connections
+    // without blocking provide `_handle_t::connect_many`, which needs no
+    // additional threads.
+    std::vector<std::future<_handle_t>> open_handles(std::size_t count) {
+      if constexpr (requires {
+                      _handle_t::connect_many(_connection_config, count);
+                    }) {
+        return _handle_t::connect_many(_connection_config, count);
+      } else {
+        auto opening = std::vector<std::future<_handle_t>>{};
+        for (std::size_t i = 0; i < count; ++i) {
+          opening.push_back(std::async(std::launch::async, [this]() {
+            return _handle_t{_connection_config};
+          }));
+        }
+        return opening;
+      }
+    }
+
+    // Threads prefer the same shard for taking and returning connections.
+    std::size_t home_shard() const {
+      static thread_local const auto hash =
+          std::hash<std::thread::id>{}(std::this_thread::get_id());
+      return hash % _shard_count;
+    }
+
+    // Takes an idle connection, starting with the calling thread's shard.
+    std::optional<idle_connection> take_idle() {
+      const auto home = home_shard();
+      for (std::size_t i = 0; i < _shard_count; ++i) {
+        auto& current = _shards[(home + i) % _shard_count];
+        std::unique_lock<std::mutex> lock{current.mutex};
+        if (not current.handles.empty()) {
+          auto idle = std::optional<idle_connection>{
+              std::move(current.handles.front())};
+          current.handles.pop_front();
+          _counters.idle.fetch_sub(1, std::memory_order_relaxed);
+          return idle;
+        }
+      }
+      return std::nullopt;
+    }
+
+    // Returns an idle connection, or nothing if the caller may open a new one.
+    // Waits in line if max_size is reached. Callers that are already waiting
+    // are served first, in the order in which they started waiting.
+    std::optional<idle_connection> acquire() {
+      if (_waiting == 0) {
+        if (auto idle = take_idle()) {
+          return idle;
+        }
+      }
+      std::unique_lock<std::mutex> lock{_mutex};
+      if (_options.max_size == 0 or _size < _options.max_size) {
+        ++_size;
+        return std::nullopt;
+      }
+
+      auto self = waiter{};
+      _waiters.push_back(&self);
+      ++_waiting;
+      // A connection may have been returned before it could see this waiter.
+      if (auto idle = take_idle()) {
+        hand_over(std::move(*idle));
+      }
+      if (not self.cv.wait_for(lock, _options.acquire_timeout,
+                               [&self] { return self.served; })) {
+        remove_waiter(&self);
+        _counters.increment(_counters.timeouts);
+        throw connection_pool_timeout{
+            "Timeout while waiting for a connection from the pool"};
+      }
+      return std::move(self.idle);
+    }
+
+    // Requires the lock.
+    void remove_waiter(waiter* self) {
+      _waiters.erase(std::find(_waiters.begin(), _waiters.end(), self));
+      --_waiting;
+    }
+
+    // Requires the lock.
+    waiter* pop_waiter() {
+      auto* front = _waiters.front();
+      _waiters.pop_front();
+      --_waiting;
+      front->served = true;
+      return front;
+    }
+
+    // Requires the lock. Hands a connection over to the longest waiting caller.
+    void hand_over(idle_connection&& idle) {
+      auto* front = pop_waiter();
+      front->idle = std::move(idle);
+      front->cv.notify_one();
+    }
+
+    void make_available(shard& target, idle_connection&& idle) {
+      // Waiting callers get the connection directly. Otherwise, a caller of
+      // get() could take it from the shard first.
+      if (_waiting > 0) {
+        std::unique_lock<std::mutex> lock{_mutex};
+        if (not _waiters.empty()) {
+          hand_over(std::move(idle));
+          return;
+        }
+      }
+      {
+        std::unique_lock<std::mutex> lock{target.mutex};
+        if (target.handles.full()) {
+          target.handles.set_capacity(target.handles.capacity() + 5);
+        }
+        target.handles.push_back(std::move(idle));
+        _counters.idle.fetch_add(1, std::memory_order_relaxed);
+      }
+      // A caller may have started waiting in the meantime. Since waiters
+      // register before looking at the shards, a waiter either finds this
+      // connection or is seen here.
+      if (_waiting > 0) {
+        std::unique_lock<std::mutex> lock{_mutex};
+        if (_waiters.empty()) {
+          return;
+        }
+        if (auto next = take_idle()) {
+          hand_over(std::move(*next));
+        }
+      }
+    }
+
+    bool exceeds_max_lifetime(const idle_connection& idle,
+                              _clock_t::time_point now) const {
+      return _options.max_lifetime.count() > 0 and
+             now - idle.created > _options.max_lifetime;
+    }
+
+    void close(idle_connection&& idle) {
+      {
+        auto closing = std::move(idle);
+      }
+      _counters.increment(_counters.closed);
+      release_slot();
+    }
+
+    _pooled_connection_t open() {
+      try {
+        auto connection = _pooled_connection_t{_connection_config,
+                                               this->shared_from_this()};
+        _counters.increment(_counters.created);
+        return connection;
+      } catch (...) {
+        _counters.increment(_counters.creation_failures);
+        release_slot();
+        throw;
+      }
+    }
+
+    // Called if a connection could not be opened or was closed.
+    void release_slot() {
+      std::unique_lock<std::mutex> lock{_mutex};
+      if (not _waiters.empty()) {
+        pop_waiter()->cv.notify_one();
+        return;
+      }
+      --_size;
+    }
+
     inline bool check_connection(_handle_t& handle, connection_check check) {
       switch (check) {
         case connection_check::none:
@@ -104,8 +513,19 @@ class connection_pool {
     }
 
     _config_ptr_t _connection_config;
-    sqlpp::detail::circular_buffer<_handle_t> _handles;
+    connection_pool_options _options;
+    std::size_t _shard_count;
+    std::unique_ptr<shard[]> _shards;
+    // Guards _size and _waiters. Idle connections are guarded by their shard.
+    // The shard locks may be taken while holding this one, not vice versa.
     std::mutex _mutex;
+    // Number of open connections, idle and in use.
+    std::size_t _size = 0;
+    std::deque<waiter*> _waiters;
+    // Size of _waiters, readable without the lock.
+    std::atomic<std::size_t> _waiting = 0;
+    sqlpp::detail::connection_pool_counters _counters;
+    sqlpp::detail::checkout_tracker _checkouts;
   };
 
   connection_pool() = default;
@@ -113,6 +533,12 @@ class connection_pool {
   connection_pool(const _config_ptr_t& connection_config, std::size_t capacity)
       : _core{std::make_shared<pool_core>(connection_config, capacity)} {}
 
+  connection_pool(const _config_ptr_t& connection_config,
+                  const connection_pool_options& options)
+      : _core{std::make_shared<pool_core>(connection_config, options)} {
+    start();
+  }
+
   connection_pool(const connection_pool&) = delete;
   connection_pool(connection_pool&&) = default;
 
@@ -121,20 +547,76 @@ class connection_pool {
 
   void initialize(const _config_ptr_t& connection_config,
                   std::size_t capacity) {
+    initialize(connection_config,
+               connection_pool_options{.capacity = capacity});
+  }
+
+  void initialize(const _config_ptr_t& connection_config,
+                  const connection_pool_options& options) {
     if (_core) {
       throw std::runtime_error{"Connection pool already initialized"};
     }
-    _core = std::make_shared<pool_core>(connection_config, capacity);
+    _core = std::make_shared<pool_core>(connection_config, options);
+    start();
+  }
+
+  // Throws connection_pool_timeout if max_size connections are in use and none
+  // is returned within the acquire timeout.
+  _pooled_connection_t get(
+      std::source_location location = std::source_location::current()) {
+    return _core->get(_core->options().checkout_check, location);
   }
 
-  _pooled_connection_t get(connection_check check = connection_check::passive) {
-    return _core->get(check);
+  _pooled_connection_t get(
+      connection_check check,
+      std::source_location location = std::source_location::current()) {
+    return _core->get(check, location);
+  }
+
+  // Closes all idle connections, e.g. after a failover. Connections in use are
+  // not affected.
+  void clear_idle() { _core->clear_idle(); }
+
+  // Connection time per call site of get(), most connection time first.
+  // Requires track_call_sites or a leak_threshold.
+  std::vector<call_site_stats> call_sites() const {
+    return _core->call_sites();
   }
 
+  // Snapshot of the pool's counters. Does not lock the pool.
+  connection_pool_stats stats() const { return _core->stats(); }
+
   // Returns number of connections available in the pool. Only used in tests.
   std::size_t available() { return _core->available(); }
 
  private:
+  // Opens min_idle connections and starts the background maintenance.
+  void start() {
+    if (not _core->needs_maintenance()) {
+      return;
+    }
+    if (auto error = _core->replenish()) {
+      std::rethrow_exception(error);
+    }
+    _maintenance = std::jthread{[core = _core](std::stop_token stop) {
+      auto mutex = std::mutex{};
+      auto cv = std::condition_variable_any{};
+      auto lock = std::unique_lock<std::mutex>{mutex};
+      while (not stop.stop_requested()) {
+        cv.wait_for(lock, stop, core->options().maintenance_interval,
+                    [] { return false; });
+        if (not stop.stop_requested()) {
+          core->maintain();
+          core->report_leaks();
+          // Failures are retried in the next round.
+          core->replenish();
+        }
+      }
+    }};
+  }
+
   std::shared_ptr<pool_core> _core;
+  // Declared last, so that the thread is stopped first.
+  std::jthread _maintenance;
 };
 }  // namespace sqlpp
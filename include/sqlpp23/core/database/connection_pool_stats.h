@@ -0,0 +1,281 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <source_location>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace sqlpp {
+// Distribution of durations. Bucket `i` counts durations shorter than `2^i`
+// microseconds (and not counted in a lower bucket). The last bucket also counts
+// all longer durations.
+struct duration_histogram {
+  static constexpr std::size_t bucket_count = 32;
+
+  std::array<std::uint64_t, bucket_count> buckets{};
+  std::uint64_t count = 0;
+  std::chrono::microseconds total{0};
+  std::chrono::microseconds max{0};
+
+  static constexpr std::chrono::microseconds upper_bound(std::size_t bucket) {
+    return std::chrono::microseconds{std::int64_t{1} << bucket};
+  }
+
+  // Upper bound of the bucket containing the given quantile, e.g. 0.99.
+  std::chrono::microseconds quantile(double q) const {
+    const auto rank = static_cast<double>(count) * q;
+    auto seen = std::uint64_t{0};
+    for (std::size_t i = 0; i < bucket_count; ++i) {
+      seen += buckets[i];
+      if (seen > 0 and static_cast<double>(seen) >= rank) {
+        return std::min(upper_bound(i), max);
+      }
+    }
+    return max;
+  }
+};
+
+struct connection_pool_stats {
+  // Open connections, idle and in use.
+  std::size_t total = 0;
+  std::size_t idle = 0;
+  std::size_t in_use = 0;
+  // Callers of get() waiting for a connection (see max_size).
+  std::size_t waiting = 0;
+
+  std::uint64_t created = 0;
+  std::uint64_t creation_failures = 0;
+  std::uint64_t closed = 0;
+  // Connections that failed a check on checkout or in the background.
+  std::uint64_t failed_checks = 0;
+  std::uint64_t timeouts = 0;
+
+  // Time spent in get(), including opening new connections.
+  duration_histogram acquire_time;
+  // Time between get() and returning the connection to the pool.
+  duration_histogram held_time;
+};
+
+// A connection held longer than the pool's leak threshold.
+struct held_connection {
+  // Where the connection was taken from the pool.
+  std::source_location location;
+  std::chrono::steady_clock::duration held;
+};
+
+// Connection time used by the callers of get() at one location.
+struct call_site_stats {
+  std::source_location location;
+  std::uint64_t checkouts = 0;
+  // Connections currently held.
+  std::uint64_t in_use = 0;
+  // Including the connections currently held.
+  std::chrono::microseconds total_held{0};
+  std::chrono::microseconds max_held{0};
+};
+
+namespace detail {
+class atomic_duration_histogram {
+ public:
+  void record(std::chrono::steady_clock::duration duration) {
+    const auto us = static_cast<std::uint64_t>(std::max<std::int64_t>(
+        0, std::chrono::duration_cast<std::chrono::microseconds>(duration)
+               .count()));
+    const auto bucket = std::min<std::size_t>(
+        std::bit_width(us), duration_histogram::bucket_count - 1);
+    _buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _total.fetch_add(us, std::memory_order_relaxed);
+    auto max = _max.load(std::memory_order_relaxed);
+    while (us > max and
+           not _max.compare_exchange_weak(max, us, std::memory_order_relaxed)) {
+    }
+  }
+
+  duration_histogram snapshot() const {
+    auto result = duration_histogram{};
+    for (std::size_t i = 0; i < duration_histogram::bucket_count; ++i) {
+      result.buckets[i] = _buckets[i].load(std::memory_order_relaxed);
+    }
+    result.count = _count.load(std::memory_order_relaxed);
+    result.total = std::chrono::microseconds{
+        static_cast<std::int64_t>(_total.load(std::memory_order_relaxed))};
+    result.max = std::chrono::microseconds{
+        static_cast<std::int64_t>(_max.load(std::memory_order_relaxed))};
+    return result;
+  }
+
+ private:
+  std::array<std::atomic<std::uint64_t>, duration_histogram::bucket_count>
+      _buckets{};
+  std::atomic<std::uint64_t> _count = 0;
+  std::atomic<std::uint64_t> _total = 0;
+  std::atomic<std::uint64_t> _max = 0;
+};
+
+// Counters updated by the pool without additional locking.
+struct connection_pool_counters {
+  static void increment(std::atomic<std::uint64_t>& counter) {
+    counter.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  connection_pool_stats snapshot(std::size_t waiting) const {
+    auto result = connection_pool_stats{};
+    result.created = created.load(std::memory_order_relaxed);
+    result.creation_failures =
+        creation_failures.load(std::memory_order_relaxed);
+    result.closed = closed.load(std::memory_order_relaxed);
+    result.failed_checks = failed_checks.load(std::memory_order_relaxed);
+    result.timeouts = timeouts.load(std::memory_order_relaxed);
+    // The counters are read one by one, keep the snapshot plausible.
+    result.total = static_cast<std::size_t>(
+        result.created > result.closed ? result.created - result.closed : 0);
+    result.idle = std::min(idle.load(std::memory_order_relaxed), result.total);
+    result.in_use = result.total - result.idle;
+    result.waiting = waiting;
+    result.acquire_time = acquire_time.snapshot();
+    result.held_time = held_time.snapshot();
+    return result;
+  }
+
+  std::atomic<std::uint64_t> created = 0;
+  std::atomic<std::uint64_t> creation_failures = 0;
+  std::atomic<std::uint64_t> closed = 0;
+  std::atomic<std::uint64_t> failed_checks = 0;
+  std::atomic<std::uint64_t> timeouts = 0;
+  std::atomic<std::size_t> idle = 0;
+  atomic_duration_histogram acquire_time;
+  atomic_duration_histogram held_time;
+};
+
+// Remembers where and when connections were taken from a pool.
+class checkout_tracker {
+  using _clock_t = std::chrono::steady_clock;
+
+ public:
+  // Returns the id of the checkout, never 0.
+  std::uint64_t track(_clock_t::time_point acquired,
+                      const std::source_location& location) {
+    std::unique_lock<std::mutex> lock{_mutex};
+    const auto id = ++_last_id;
+    _checkouts.emplace(id, checkout{acquired, location, false});
+    return id;
+  }
+
+  void untrack(std::uint64_t id, _clock_t::time_point released) {
+    std::unique_lock<std::mutex> lock{_mutex};
+    const auto it = _checkouts.find(id);
+    if (it == _checkouts.end()) {
+      return;
+    }
+    add(_sites[key_of(it->second.location)], it->second, released);
+    _checkouts.erase(it);
+  }
+
+  // Checkouts held longer than the threshold. Each is reported once.
+  std::vector<held_connection> held_longer_than(
+      _clock_t::duration threshold) {
+    const auto now = _clock_t::now();
+    auto result = std::vector<held_connection>{};
+    std::unique_lock<std::mutex> lock{_mutex};
+    for (auto& [id, c] : _checkouts) {
+      if (not c.reported and now - c.acquired > threshold) {
+        c.reported = true;
+        result.push_back({c.location, now - c.acquired});
+      }
+    }
+    return result;
+  }
+
+  // Sorted by total connection time, descending.
+  std::vector<call_site_stats> call_sites() const {
+    const auto now = _clock_t::now();
+    std::unique_lock<std::mutex> lock{_mutex};
+    auto sites = _sites;
+    for (const auto& [id, c] : _checkouts) {
+      auto& site = sites[key_of(c.location)];
+      add(site, c, now);
+      ++site.in_use;
+    }
+    lock.unlock();
+
+    auto result = std::vector<call_site_stats>{};
+    for (auto& [key, site] : sites) {
+      result.push_back(site);
+    }
+    std::ranges::sort(result, [](const auto& lhs, const auto& rhs) {
+      return lhs.total_held > rhs.total_held;
+    });
+    return result;
+  }
+
+ private:
+  struct checkout {
+    _clock_t::time_point acquired;
+    std::source_location location;
+    bool reported;
+  };
+
+  using site_key = std::tuple<std::string_view,
+                              std::uint_least32_t,
+                              std::uint_least32_t,
+                              std::string_view>;
+
+  static site_key key_of(const std::source_location& location) {
+    return {location.file_name(), location.line(), location.column(),
+            location.function_name()};
+  }
+
+  static void add(call_site_stats& site,
+                  const checkout& c,
+                  _clock_t::time_point released) {
+    const auto held = std::chrono::duration_cast<std::chrono::microseconds>(
+        released - c.acquired);
+    site.location = c.location;
+    ++site.checkouts;
+    site.total_held += held;
+    site.max_held = std::max(site.max_held, held);
+  }
+
+  mutable std::mutex _mutex;
+  std::uint64_t _last_id = 0;
+  std::unordered_map<std::uint64_t, checkout> _checkouts;
+  std::map<site_key, call_site_stats> _sites;
+};
+}  // namespace detail
+}  // namespace sqlpp
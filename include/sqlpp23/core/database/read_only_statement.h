@@ -0,0 +1,58 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <type_traits>
+
+#include <sqlpp23/core/clause/for_update.h>
+#include <sqlpp23/core/clause/select_column_list.h>
+#include <sqlpp23/core/query/statement.h>
+
+namespace sqlpp {
+// Selects (including unions of selects) without `for_update` can be executed
+// on a read replica or be served from a query cache.
+template <typename Statement>
+struct is_read_only_statement : public std::false_type {};
+
+template <typename T>
+struct is_select_result_methods : public std::false_type {};
+
+template <typename... Columns>
+struct is_select_result_methods<select_result_methods_t<Columns...>>
+    : public std::true_type {};
+
+template <typename... Clauses>
+struct is_read_only_statement<statement_t<Clauses...>>
+    : public std::integral_constant<
+          bool,
+          is_select_result_methods<result_methods_t<Clauses...>>::value and
+              not(std::is_same_v<Clauses, for_update_t> or ...)> {};
+
+template <typename Statement>
+inline constexpr bool is_read_only_statement_v =
+    is_read_only_statement<Statement>::value;
+}  // namespace sqlpp
@@ -0,0 +1,318 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/core/database/connection_pool.h>
+#include <sqlpp23/core/database/read_only_statement.h>
+#include <sqlpp23/core/query/statement.h>
+#include <sqlpp23/core/type_traits.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <source_location>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sqlpp {
+struct routing_pool_options {
+  connection_pool_options primary = {};
+  // Used for each replica.
+  connection_pool_options replica = {};
+  // How long a replica is skipped after it failed.
+  std::chrono::milliseconds eviction_time = std::chrono::seconds{30};
+};
+
+// Routes statements to a primary and a set of read replicas. Read-only
+// statements go to the replica with the fewest outstanding requests, all other
+// statements go to the primary.
+template <typename ConnectionBase>
+class routing_pool {
+  using _clock_t = std::chrono::steady_clock;
+
+  struct replica_t {
+    replica_t(const typename ConnectionBase::_config_ptr_t& config,
+              const connection_pool_options& options)
+        : pool{config, options} {}
+
+    connection_pool<ConnectionBase> pool;
+    std::atomic<std::size_t> outstanding = 0;
+    // Nanoseconds since the epoch of the steady clock.
+    std::atomic<std::int64_t> evicted_until = 0;
+  };
+
+ public:
+  using _config_ptr_t = typename ConnectionBase::_config_ptr_t;
+  using _pooled_connection_t = sqlpp::pooled_connection<ConnectionBase>;
+
+  // A connection from the primary or one of the replicas. Counts as an
+  // outstanding request of its replica as long as it exists.
+  class routed_connection {
+   public:
+    routed_connection(_pooled_connection_t connection,
+                      std::shared_ptr<replica_t> replica)
+        : _connection{std::move(connection)}, _replica{std::move(replica)} {
+      if (_replica) {
+        ++_replica->outstanding;
+      }
+    }
+
+    routed_connection(const routed_connection&) = delete;
+    routed_connection(routed_connection&& other) = default;
+    routed_connection& operator=(const routed_connection&) = delete;
+    routed_connection& operator=(routed_connection&& other) = delete;
+
+    ~routed_connection() {
+      if (_replica) {
+        --_replica->outstanding;
+      }
+    }
+
+    bool is_replica() const { return _replica != nullptr; }
+
+    _pooled_connection_t& connection() { return _connection; }
+
+    template <typename T>
+    auto operator()(T&& t) {
+      return _connection(std::forward<T>(t));
+    }
+
+   private:
+    friend class routing_pool;
+
+    _pooled_connection_t _connection;
+    std::shared_ptr<replica_t> _replica;
+  };
+
+  // Result of a select, together with the connection it is read from.
+  template <typename Result>
+  class routed_result {
+   public:
+    routed_result(routed_connection connection, Result result)
+        : _connection{std::move(connection)}, _result{std::move(result)} {}
+
+    auto begin() { return _result.begin(); }
+    auto end() { return _result.end(); }
+    const auto& front() const { return _result.front(); }
+    bool empty() const { return _result.empty(); }
+    void pop_front() { _result.pop_front(); }
+
+    bool is_replica() const { return _connection.is_replica(); }
+
+   private:
+    routed_connection _connection;
+    Result _result;
+  };
+
+  routing_pool(const _config_ptr_t& primary,
+               const std::vector<_config_ptr_t>& replicas,
+               const routing_pool_options& options = {})
+      : _primary{primary, options.primary}, _options{options} {
+    for (const auto& config : replicas) {
+      _replicas.push_back(std::make_shared<replica_t>(config, options.replica));
+    }
+  }
+
+  routing_pool(const routing_pool&) = delete;
+  routing_pool(routing_pool&&) = delete;
+  routing_pool& operator=(const routing_pool&) = delete;
+  routing_pool& operator=(routing_pool&&) = delete;
+
+  // Without a check, the primary pool's checkout_check applies.
+  routed_connection get_primary(
+      std::source_location location = std::source_location::current()) {
+    return primary_connection(std::nullopt, location);
+  }
+
+  routed_connection get_primary(
+      connection_check check,
+      std::source_location location = std::source_location::current()) {
+    return primary_connection(check, location);
+  }
+
+  // Returns a connection to the available replica with the fewest outstanding
+  // requests. Replicas that fail to open a connection are evicted. Falls back
+  // to the primary if no replica is available. Throws connection_pool_timeout
+  // if the chosen replica has no connection to spare. Without a check, the
+  // replica pool's checkout_check applies.
+  routed_connection get_replica(
+      std::source_location location = std::source_location::current()) {
+    return replica_connection(std::nullopt, location);
+  }
+
+  routed_connection get_replica(
+      connection_check check,
+      std::source_location location = std::source_location::current()) {
+    return replica_connection(check, location);
+  }
+
+  // Returns a connection suitable for the statement.
+  template <typename Statement>
+  routed_connection get(
+      const Statement& statement,
+      std::source_location location = std::source_location::current()) {
+    return connection_for(statement, std::nullopt, location);
+  }
+
+  template <typename Statement>
+  routed_connection get(
+      const Statement& statement,
+      connection_check check,
+      std::source_location location = std::source_location::current()) {
+    return connection_for(statement, check, location);
+  }
+
+  // Executes the statement on a connection suitable for the statement. If a
+  // read-only statement fails because the replica's connection is lost, the
+  // replica is evicted and the statement is retried on the next choice.
+  // Results with rows hold their connection until they are destroyed.
+  template <typename Statement>
+  auto operator()(
+      Statement&& statement,
+      std::source_location location = std::source_location::current()) {
+    for (;;) {
+      auto db = get(statement, location);
+      try {
+        if constexpr (has_result_row<std::remove_cvref_t<Statement>>::value) {
+          auto result = db(statement);
+          return routed_result<decltype(result)>{std::move(db),
+                                                 std::move(result)};
+        } else {
+          return db(statement);
+        }
+      } catch (const sqlpp::exception&) {
+        if (not db.is_replica() or db.connection().is_connected()) {
+          throw;
+        }
+        evict(*db._replica);
+      }
+    }
+  }
+
+  // Marks the replica of the connection as failed, e.g. after detecting that it
+  // lags behind.
+  void evict(const routed_connection& connection) {
+    if (connection._replica) {
+      evict(*connection._replica);
+    }
+  }
+
+  connection_pool<ConnectionBase>& primary() { return _primary; }
+
+  std::size_t replica_count() const { return _replicas.size(); }
+
+  connection_pool<ConnectionBase>& replica(std::size_t index) {
+    return _replicas.at(index)->pool;
+  }
+
+ private:
+  static _pooled_connection_t get_from(connection_pool<ConnectionBase>& pool,
+                                       std::optional<connection_check> check,
+                                       const std::source_location& location) {
+    return check ? pool.get(*check, location) : pool.get(location);
+  }
+
+  routed_connection primary_connection(std::optional<connection_check> check,
+                                       const std::source_location& location) {
+    return routed_connection{get_from(_primary, check, location), nullptr};
+  }
+
+  routed_connection replica_connection(std::optional<connection_check> check,
+                                       const std::source_location& location) {
+    auto skipped = std::vector<const replica_t*>{};
+    while (auto replica = choose_replica(skipped)) {
+      try {
+        return routed_connection{get_from(replica->pool, check, location),
+                                 replica};
+      } catch (const connection_pool_timeout&) {
+        // The replica is busy, not broken.
+        throw;
+      } catch (const sqlpp::exception&) {
+        evict(*replica);
+        skipped.push_back(replica.get());
+      }
+    }
+    return primary_connection(check, location);
+  }
+
+  template <typename Statement>
+  routed_connection connection_for(const Statement&,
+                                   std::optional<connection_check> check,
+                                   const std::source_location& location) {
+    if constexpr (is_read_only_statement_v<std::remove_cvref_t<Statement>>) {
+      return replica_connection(check, location);
+    } else {
+      return primary_connection(check, location);
+    }
+  }
+
+  static std::int64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               _clock_t::now().time_since_epoch())
+        .count();
+  }
+
+  void evict(replica_t& replica) {
+    replica.evicted_until =
+        now() + std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    _options.eviction_time)
+                    .count();
+  }
+
+  // Least outstanding requests. Ties are broken round robin.
+  std::shared_ptr<replica_t> choose_replica(
+      const std::vector<const replica_t*>& skipped) {
+    const auto time = now();
+    const auto start = _next++;
+    auto best = std::shared_ptr<replica_t>{};
+    auto fewest = std::numeric_limits<std::size_t>::max();
+    for (std::size_t i = 0; i < _replicas.size(); ++i) {
+      const auto& replica = _replicas[(start + i) % _replicas.size()];
+      if (replica->evicted_until > time or
+          std::ranges::find(skipped, replica.get()) != skipped.end()) {
+        continue;
+      }
+      if (const auto outstanding = replica->outstanding.load();
+          outstanding < fewest) {
+        best = replica;
+        fewest = outstanding;
+      }
+    }
+    return best;
+  }
+
+  connection_pool<ConnectionBase> _primary;
+  std::vector<std::shared_ptr<replica_t>> _replicas;
+  routing_pool_options _options;
+  std::atomic<std::size_t> _next = 0;
+};
+}  // namespace sqlpp
@@ -0,0 +1,296 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/core/database/connection_pool.h>
+#include <sqlpp23/core/type_traits.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <source_location>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sqlpp {
+// Maps keys to shards by hash.
+template <typename Key>
+std::function<std::size_t(const Key&)> hash_sharding(std::size_t shard_count) {
+  return [shard_count](const Key& key) {
+    return std::hash<Key>{}(key) % shard_count;
+  };
+}
+
+// Maps keys to shards by range: Shard `i` holds keys below `upper_bounds[i]`
+// (and not below `upper_bounds[i - 1]`). The last shard holds all keys not
+// below the last bound, i.e. `upper_bounds.size()` has to be the number of
+// shards minus one (otherwise, see sharded_pool::shard_of()).
+template <typename Key>
+std::function<std::size_t(const Key&)> range_sharding(
+    std::vector<Key> upper_bounds) {
+  return [upper_bounds = std::move(upper_bounds)](const Key& key) {
+    const auto it = std::ranges::upper_bound(upper_bounds, key);
+    return static_cast<std::size_t>(it - upper_bounds.begin());
+  };
+}
+
+// Rows of the results of one statement executed on several shards. Without a
+// comparison, the results are read one after the other. With a comparison,
+// the results are merged (assuming that each is ordered accordingly).
+template <typename Connection, typename Result>
+class merged_result {
+ public:
+  using result_row_t =
+      std::remove_cvref_t<decltype(std::declval<Result&>().front())>;
+  using compare_t =
+      std::function<bool(const result_row_t&, const result_row_t&)>;
+
+  struct part_t {
+    Connection connection;
+    Result result;
+  };
+
+  merged_result(std::vector<part_t> parts, compare_t less)
+      : _parts{std::move(parts)}, _less{std::move(less)} {
+    for (std::size_t i = 0; i < _parts.size(); ++i) {
+      if (not _parts[i].result.empty()) {
+        _heap.push_back(i);
+      }
+    }
+    if (_less) {
+      std::ranges::make_heap(_heap, greater());
+    } else {
+      std::ranges::reverse(_heap);
+    }
+  }
+
+  merged_result(const merged_result&) = delete;
+  merged_result(merged_result&&) = default;
+  merged_result& operator=(const merged_result&) = delete;
+  merged_result& operator=(merged_result&&) = default;
+
+  class iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = result_row_t;
+    using pointer = const result_row_t*;
+    using reference = const result_row_t&;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+    explicit iterator(merged_result* result) : _result{result} {}
+
+    reference operator*() const { return _result->front(); }
+    pointer operator->() const { return &_result->front(); }
+
+    bool operator==(const iterator& rhs) const {
+      return at_end() == rhs.at_end();
+    }
+
+    iterator& operator++() {
+      _result->pop_front();
+      return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+   private:
+    bool at_end() const { return _result == nullptr or _result->empty(); }
+
+    merged_result* _result = nullptr;
+  };
+
+  iterator begin() { return iterator{this}; }
+  iterator end() { return iterator{}; }
+
+  bool empty() const { return _heap.empty(); }
+
+  const result_row_t& front() const {
+    return _parts[current()].result.front();
+  }
+
+  void pop_front() {
+    if (not _less) {
+      auto& result = _parts[_heap.back()].result;
+      result.pop_front();
+      if (result.empty()) {
+        _heap.pop_back();
+      }
+      return;
+    }
+    std::ranges::pop_heap(_heap, greater());
+    auto& result = _parts[_heap.back()].result;
+    result.pop_front();
+    if (result.empty()) {
+      _heap.pop_back();
+    } else {
+      std::ranges::push_heap(_heap, greater());
+    }
+  }
+
+ private:
+  // Index of the part providing the current row.
+  std::size_t current() const { return _less ? _heap.front() : _heap.back(); }
+
+  // Turns the max-heap of the standard library into a min-heap.
+  auto greater() {
+    return [this](std::size_t lhs, std::size_t rhs) {
+      return _less(_parts[rhs].result.front(), _parts[lhs].result.front());
+    };
+  }
+
+  std::vector<part_t> _parts;
+  compare_t _less;
+  // Indexes of the parts with remaining rows. Without a comparison, the part
+  // to read from is at the back.
+  std::vector<std::size_t> _heap;
+};
+
+// Connection pools for a set of shards. Keys (e.g. tenant ids) are mapped to
+// shards by a user provided function.
+template <typename ConnectionBase, typename Key = std::int64_t>
+class sharded_pool {
+ public:
+  using _config_ptr_t = typename ConnectionBase::_config_ptr_t;
+  using _pooled_connection_t = sqlpp::pooled_connection<ConnectionBase>;
+  using shard_function_t = std::function<std::size_t(const Key&)>;
+
+  sharded_pool(const std::vector<_config_ptr_t>& configs,
+               shard_function_t shard_function,
+               const connection_pool_options& options = {})
+      : _shard_function{std::move(shard_function)} {
+    if (configs.empty()) {
+      throw std::invalid_argument{"sharded_pool requires at least one shard"};
+    }
+    for (const auto& config : configs) {
+      _shards.push_back(
+          std::make_unique<connection_pool<ConnectionBase>>(config, options));
+    }
+  }
+
+  // Uses hash_sharding.
+  sharded_pool(const std::vector<_config_ptr_t>& configs,
+               const connection_pool_options& options = {})
+      : sharded_pool{configs, hash_sharding<Key>(configs.size()), options} {}
+
+  sharded_pool(const sharded_pool&) = delete;
+  sharded_pool(sharded_pool&&) = default;
+  sharded_pool& operator=(const sharded_pool&) = delete;
+  sharded_pool& operator=(sharded_pool&&) = default;
+
+  std::size_t shard_count() const { return _shards.size(); }
+
+  // Throws std::out_of_range if the shard function returns an invalid index.
+  std::size_t shard_of(const Key& key) const {
+    const auto index = _shard_function(key);
+    if (index >= _shards.size()) {
+      throw std::out_of_range{"Shard function returned an invalid shard"};
+    }
+    return index;
+  }
+
+  connection_pool<ConnectionBase>& shard(std::size_t index) {
+    return *_shards.at(index);
+  }
+
+  // Connection to the shard holding the key. Without a check, the shard
+  // pool's checkout_check applies.
+  _pooled_connection_t get(
+      const Key& key,
+      std::source_location location = std::source_location::current()) {
+    return _shards[shard_of(key)]->get(location);
+  }
+
+  _pooled_connection_t get(
+      const Key& key,
+      connection_check check,
+      std::source_location location = std::source_location::current()) {
+    return _shards[shard_of(key)]->get(check, location);
+  }
+
+  // Executes a select on all shards concurrently. The rows of the results are
+  // read one shard after the other.
+  template <typename Statement>
+  auto scatter(
+      const Statement& statement,
+      std::source_location location = std::source_location::current()) {
+    return scatter(statement, nullptr, location);
+  }
+
+  // Executes a select on all shards concurrently. The results are merged using
+  // `less`, which has to match the statement's `order_by`, e.g.
+  //   [](const auto& lhs, const auto& rhs) { return lhs.id < rhs.id; }
+  template <typename Statement, typename Less>
+  auto scatter(
+      const Statement& statement,
+      Less less,
+      std::source_location location = std::source_location::current()) {
+    static_assert(has_result_row<Statement>::value,
+                  "scatter requires a statement with result rows");
+    using result_type =
+        decltype(std::declval<_pooled_connection_t&>()(statement));
+    using merged_t = merged_result<_pooled_connection_t, result_type>;
+
+    auto running = std::vector<std::future<typename merged_t::part_t>>{};
+    for (auto& shard : _shards) {
+      running.push_back(std::async(
+          std::launch::async, [&statement, location, pool = shard.get()]() {
+            auto connection = pool->get(location);
+            auto result = connection(statement);
+            return typename merged_t::part_t{std::move(connection),
+                                             std::move(result)};
+          }));
+    }
+
+    // Wait for all shards before reporting the first error.
+    auto parts = std::vector<typename merged_t::part_t>{};
+    auto error = std::exception_ptr{};
+    for (auto& part : running) {
+      try {
+        parts.push_back(part.get());
+      } catch (...) {
+        if (not error) {
+          error = std::current_exception();
+        }
+      }
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    return merged_t{std::move(parts), typename merged_t::compare_t{less}};
+  }
+
+ private:
+  shard_function_t _shard_function;
+  std::vector<std::unique_ptr<connection_pool<ConnectionBase>>> _shards;
+};
+}  // namespace sqlpp
@@ -0,0 +1,135 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace sqlpp::detail {
+// Bump allocator for the bytes of text and blob fields. Memory is allocated
+// in chunks and released all at once.
+class arena {
+ public:
+  explicit arena(std::size_t chunk_size = 64 * 1024)
+      : _chunk_size(chunk_size) {}
+
+  arena(const arena&) = delete;
+  arena(arena&& other) noexcept
+      : _chunk_size(other._chunk_size),
+        _chunks(std::move(other._chunks)),
+        _current(std::exchange(other._current, 0)),
+        _next(std::exchange(other._next, nullptr)),
+        _end(std::exchange(other._end, nullptr)),
+        _capacity(std::exchange(other._capacity, 0)) {}
+  arena& operator=(const arena&) = delete;
+  arena& operator=(arena&& other) noexcept {
+    if (this != &other) {
+      _chunk_size = other._chunk_size;
+      _chunks = std::move(other._chunks);
+      _current = std::exchange(other._current, 0);
+      _next = std::exchange(other._next, nullptr);
+      _end = std::exchange(other._end, nullptr);
+      _capacity = std::exchange(other._capacity, 0);
+    }
+    return *this;
+  }
+  ~arena() = default;
+
+  std::string_view copy(std::string_view value) {
+    return {reinterpret_cast<const char*>(
+                copy_bytes(value.data(), value.size())),
+            value.size()};
+  }
+
+  std::span<const std::uint8_t> copy(std::span<const std::uint8_t> value) {
+    return {reinterpret_cast<const std::uint8_t*>(
+                copy_bytes(value.data(), value.size())),
+            value.size()};
+  }
+
+  // Invalidates all copies. Keeps the chunks for reuse.
+  void clear() {
+    _current = 0;
+    _next = _chunks.empty() ? nullptr : _chunks.front().data.get();
+    _end = _chunks.empty() ? nullptr : _next + _chunks.front().size;
+  }
+
+  // Bytes allocated in chunks
+  std::size_t capacity() const { return _capacity; }
+
+  std::size_t chunk_count() const { return _chunks.size(); }
+
+ private:
+  const std::byte* copy_bytes(const void* data, std::size_t size) {
+    if (size == 0) {
+      return nullptr;
+    }
+    while (static_cast<std::size_t>(_end - _next) < size) {
+      next_chunk(size);
+    }
+    auto* target = std::exchange(_next, _next + size);
+    std::memcpy(target, data, size);
+    return target;
+  }
+
+  void next_chunk(std::size_t size) {
+    if (_next != nullptr) {
+      ++_current;
+    }
+    if (_current == _chunks.size()) {
+      // Large values get a chunk of their own.
+      const auto chunk_size = std::max(_chunk_size, size);
+      _chunks.push_back(
+          {std::make_unique_for_overwrite<std::byte[]>(chunk_size),
+           chunk_size});
+      _capacity += chunk_size;
+    }
+    _next = _chunks[_current].data.get();
+    _end = _next + _chunks[_current].size;
+  }
+
+  struct chunk {
+    std::unique_ptr<std::byte[]> data;
+    std::size_t size;
+  };
+
+  std::size_t _chunk_size;
+  std::vector<chunk> _chunks;
+  // Index of the chunk that _next points into
+  std::size_t _current = 0;
+  std::byte* _next = nullptr;
+  std::byte* _end = nullptr;
+  std::size_t _capacity = 0;
+};
+}  // namespace sqlpp::detail
@@ -42,6 +42,12 @@ struct in_expression;
 template <typename L>
 struct sort_order_expression;
 
+template <typename DataType, typename NameTag>
+struct parameter_t;
+
+template <typename DataType, typename NameTag>
+struct array_parameter_t;
+
 struct op_is_null {
   static constexpr auto symbol = " IS ";
 };
@@ -131,6 +137,13 @@ constexpr auto in(L lhs, std::vector<Arg> args)
   return {std::move(lhs), std::move(args)};
 }
 
+template <typename L, typename DataType, typename NameTag>
+  requires(values_are_comparable<L, parameter_t<DataType, NameTag>>::value)
+constexpr auto in(L lhs, array_parameter_t<DataType, NameTag> arg)
+    -> in_expression<L, operator_in, array_parameter_t<DataType, NameTag>> {
+  return {std::move(lhs), std::move(arg)};
+}
+
 template <typename L, typename... Args>
   requires((sizeof...(Args) != 0) and
            logic::all<values_are_comparable<L, Args>::value...>::value)
@@ -154,6 +167,13 @@ constexpr auto not_in(L lhs, std::vector<Arg> args)
   return {std::move(lhs), std::move(args)};
 }
 
+template <typename L, typename DataType, typename NameTag>
+  requires(values_are_comparable<L, parameter_t<DataType, NameTag>>::value)
+constexpr auto not_in(L lhs, array_parameter_t<DataType, NameTag> arg)
+    -> in_expression<L, operator_not_in, array_parameter_t<DataType, NameTag>> {
+  return {std::move(lhs), std::move(arg)};
+}
+
 template <typename L, typename R1, typename R2>
   requires(values_are_comparable<L, R1>::value and
            values_are_comparable<L, R2>::value)
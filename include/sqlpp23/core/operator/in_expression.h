@@ -94,6 +94,27 @@ template <typename L, typename Operator, typename R>
 struct requires_parentheses<in_expression<L, Operator, std::vector<R>>>
     : public std::true_type {};
 
+template <typename DataType, typename NameTag>
+struct array_parameter_t;
+
+template <typename L, typename Operator, typename DataType, typename NameTag>
+struct data_type_of<
+    in_expression<L, Operator, array_parameter_t<DataType, NameTag>>>
+    : std::conditional<sqlpp::is_optional<data_type_of_t<L>>::value,
+                       std::optional<boolean>,
+                       boolean> {};
+
+template <typename L, typename Operator, typename DataType, typename NameTag>
+struct nodes_of<
+    in_expression<L, Operator, array_parameter_t<DataType, NameTag>>> {
+  using type = detail::type_vector<L, array_parameter_t<DataType, NameTag>>;
+};
+
+template <typename L, typename Operator, typename DataType, typename NameTag>
+struct requires_parentheses<
+    in_expression<L, Operator, array_parameter_t<DataType, NameTag>>>
+    : public std::true_type {};
+
 template <typename L, typename Operator, typename... Args>
 struct nodes_of<in_expression<L, Operator, std::tuple<Args...>>> {
   using type = detail::type_vector<L, Args...>;
@@ -144,4 +165,18 @@ auto to_sql_string(Context& context,
   return result;
 }
 
+// The whole list of values is bound to a single array parameter, see
+// array_parameter(). Connectors without array support override this.
+template <typename Context, typename L, typename Operator, typename DataType,
+          typename NameTag>
+auto to_sql_string(
+    Context& context,
+    const in_expression<L, Operator, array_parameter_t<DataType, NameTag>>& t)
+    -> std::string {
+  constexpr auto quantifier =
+      std::is_same_v<Operator, operator_not_in> ? " <> ALL(" : " = ANY(";
+  return operand_to_sql_string(context, read.lhs(t)) + quantifier +
+         to_sql_string(context, read.rhs(t)) + ")";
+}
+
 }  // namespace sqlpp
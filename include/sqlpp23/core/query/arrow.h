@@ -0,0 +1,406 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/query/column_batch.h>
+#include <sqlpp23/core/type_traits.h>
+
+// Arrow C data and stream interfaces, see
+// https://arrow.apache.org/docs/format/CDataInterface.html
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C" {
+struct ArrowSchema {
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+  void (*release)(struct ArrowSchema*);
+  void* private_data;
+};
+
+struct ArrowArray {
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+  void (*release)(struct ArrowArray*);
+  void* private_data;
+};
+}
+#endif  // ARROW_C_DATA_INTERFACE
+
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+extern "C" {
+struct ArrowArrayStream {
+  int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+  int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+  const char* (*get_last_error)(struct ArrowArrayStream*);
+  void (*release)(struct ArrowArrayStream*);
+  void* private_data;
+};
+}
+#endif  // ARROW_C_STREAM_INTERFACE
+
+namespace sqlpp {
+namespace detail {
+template <typename DataType>
+struct arrow_format;
+
+template <>
+struct arrow_format<boolean> {
+  static constexpr const char* value = "b";
+};
+
+template <>
+struct arrow_format<integral> {
+  static constexpr const char* value = "l";
+};
+
+template <>
+struct arrow_format<unsigned_integral> {
+  static constexpr const char* value = "L";
+};
+
+template <>
+struct arrow_format<floating_point> {
+  static constexpr const char* value = "g";
+};
+
+// Large variants, with 64 bit offsets like column_buffer.
+template <>
+struct arrow_format<text> {
+  static constexpr const char* value = "U";
+};
+
+template <>
+struct arrow_format<blob> {
+  static constexpr const char* value = "Z";
+};
+
+// Days since the epoch, 32 bit
+template <>
+struct arrow_format<date> {
+  static constexpr const char* value = "tdD";
+};
+
+template <>
+struct arrow_format<timestamp> {
+  static constexpr const char* value = "tsu:";
+};
+
+template <>
+struct arrow_format<time> {
+  static constexpr const char* value = "ttu";
+};
+
+template <typename FieldSpec>
+ArrowSchema make_arrow_schema() {
+  using _data_type = data_type_of_t<FieldSpec>;
+  return ArrowSchema{
+      .format = arrow_format<remove_optional_t<_data_type>>::value,
+      .name = name_tag_of_t<FieldSpec>::name,
+      .metadata = nullptr,
+      .flags = is_optional<_data_type>::value ? ARROW_FLAG_NULLABLE : 0,
+      .n_children = 0,
+      .children = nullptr,
+      .dictionary = nullptr,
+      // Names and formats are static, there is nothing to release.
+      .release = [](ArrowSchema* schema) { schema->release = nullptr; },
+      .private_data = nullptr};
+}
+
+struct arrow_schema_children {
+  std::vector<ArrowSchema> schemas;
+  std::vector<ArrowSchema*> pointers;
+};
+
+inline void release_arrow_schema(ArrowSchema* schema) {
+  for (int64_t i = 0; i < schema->n_children; ++i) {
+    if (schema->children[i]->release) {
+      schema->children[i]->release(schema->children[i]);
+    }
+  }
+  delete static_cast<arrow_schema_children*>(schema->private_data);
+  schema->release = nullptr;
+}
+
+template <typename... FieldSpecs>
+void export_arrow_schema(ArrowSchema* out) {
+  auto children = std::make_unique<arrow_schema_children>();
+  children->schemas = {make_arrow_schema<FieldSpecs>()...};
+  for (auto& child : children->schemas) {
+    children->pointers.push_back(&child);
+  }
+  *out = ArrowSchema{.format = "+s",
+                     .name = "",
+                     .metadata = nullptr,
+                     .flags = 0,
+                     .n_children = sizeof...(FieldSpecs),
+                     .children = children->pointers.data(),
+                     .dictionary = nullptr,
+                     .release = &release_arrow_schema,
+                     .private_data = children.release()};
+}
+
+// Owns the exported batch. The parent array and each child array hold a
+// reference, so that consumers can move children out of the parent.
+template <typename Batch>
+struct arrow_array_data {
+  explicit arrow_array_data(Batch&& b) : batch(std::move(b)) {}
+
+  Batch batch;
+  // bool is bit-packed, dates are stored as 32 bit days.
+  std::vector<std::vector<std::uint8_t>> bits;
+  std::vector<std::vector<std::int32_t>> days;
+  std::vector<std::array<const void*, 3>> buffers;
+  std::vector<ArrowArray> children;
+  std::vector<ArrowArray*> pointers;
+  std::array<const void*, 1> struct_buffers = {nullptr};
+};
+
+inline void release_arrow_child(ArrowArray* array) {
+  delete static_cast<std::shared_ptr<void>*>(array->private_data);
+  array->release = nullptr;
+}
+
+inline void release_arrow_array(ArrowArray* array) {
+  for (int64_t i = 0; i < array->n_children; ++i) {
+    if (array->children[i]->release) {
+      array->children[i]->release(array->children[i]);
+    }
+  }
+  delete static_cast<std::shared_ptr<void>*>(array->private_data);
+  array->release = nullptr;
+}
+
+template <typename Data, typename ResultType>
+ArrowArray make_arrow_child(const std::shared_ptr<Data>& data,
+                            std::size_t index,
+                            const column_buffer<ResultType>& column) {
+  using _column_t = column_buffer<ResultType>;
+  using _value_t = remove_optional_t<ResultType>;
+  const auto length = static_cast<int64_t>(column.size());
+
+  auto null_count = int64_t{0};
+  auto& buffers = data->buffers[index];
+  buffers = {nullptr, nullptr, nullptr};
+  if constexpr (_column_t::is_nullable) {
+    for (const auto byte : column.validity()) {
+      null_count += std::popcount(byte);
+    }
+    null_count = length - null_count;
+    if (null_count > 0) {
+      buffers[0] = column.validity().data();
+    }
+  }
+
+  if constexpr (_column_t::is_variable_width) {
+    buffers[1] = column.offsets().data();
+    buffers[2] = column.data().data();
+  } else if constexpr (std::is_same_v<_value_t, bool>) {
+    auto& bits = data->bits.emplace_back((column.size() + 7) / 8, 0);
+    const auto values = column.values();
+    for (std::size_t row = 0; row < values.size(); ++row) {
+      if (values[row]) {
+        bits[row / 8] |= static_cast<std::uint8_t>(1u << (row % 8));
+      }
+    }
+    buffers[1] = bits.data();
+  } else if constexpr (std::is_same_v<_value_t, std::chrono::sys_days>) {
+    auto& days = data->days.emplace_back();
+    days.reserve(column.size());
+    for (const auto& day : column.values()) {
+      days.push_back(static_cast<std::int32_t>(day.time_since_epoch().count()));
+    }
+    buffers[1] = days.data();
+  } else {
+    static_assert(sizeof(_value_t) == 8,
+                  "Arrow expects 64 bit values for this column");
+    buffers[1] = column.values().data();
+  }
+
+  return ArrowArray{.length = length,
+                    .null_count = null_count,
+                    .offset = 0,
+                    .n_buffers = _column_t::is_variable_width ? 3 : 2,
+                    .n_children = 0,
+                    .buffers = buffers.data(),
+                    .children = nullptr,
+                    .dictionary = nullptr,
+                    .release = &release_arrow_child,
+                    .private_data = new std::shared_ptr<void>(data)};
+}
+
+template <typename... FieldSpecs, std::size_t... Is>
+void export_arrow_array(column_batch<FieldSpecs...>&& batch,
+                        ArrowArray* out,
+                        std::index_sequence<Is...>) {
+  auto data = std::make_shared<arrow_array_data<column_batch<FieldSpecs...>>>(
+      std::move(batch));
+  const auto length = static_cast<int64_t>(data->batch.size());
+  // Keep references to the converted buffers stable.
+  data->bits.reserve(sizeof...(FieldSpecs));
+  data->days.reserve(sizeof...(FieldSpecs));
+  data->buffers.resize(sizeof...(FieldSpecs));
+  data->children = {make_arrow_child(
+      data, Is,
+      static_cast<const member_t<
+          FieldSpecs, column_buffer<typename FieldSpecs::result_data_type>>&>(
+          data->batch)())...};
+  for (auto& child : data->children) {
+    data->pointers.push_back(&child);
+  }
+
+  *out = ArrowArray{.length = length,
+                    .null_count = 0,
+                    .offset = 0,
+                    .n_buffers = 1,
+                    .n_children = sizeof...(FieldSpecs),
+                    .buffers = data->struct_buffers.data(),
+                    .children = data->pointers.data(),
+                    .dictionary = nullptr,
+                    .release = &release_arrow_array,
+                    .private_data = nullptr};
+  out->private_data = new std::shared_ptr<void>(std::move(data));
+}
+
+template <typename Result>
+struct arrow_stream_data {
+  Result result;
+  std::size_t batch_size;
+  std::string last_error;
+};
+}  // namespace detail
+
+// Arrow schema of the result's rows: A struct with one child per selected
+// column, named like the column, with the type derived from its data type.
+template <typename DbResult, typename... FieldSpecs>
+void export_arrow_schema(
+    const result_t<DbResult, result_row_t<FieldSpecs...>>&,
+    ArrowSchema* out) {
+  detail::export_arrow_schema<FieldSpecs...>(out);
+}
+
+template <typename... FieldSpecs>
+void export_arrow_schema(const column_batch<FieldSpecs...>&,
+                         ArrowSchema* out) {
+  detail::export_arrow_schema<FieldSpecs...>(out);
+}
+
+// Exports the batch as an Arrow struct array. The array takes ownership of the
+// batch's buffers. Only bool and date columns are converted.
+template <typename... FieldSpecs>
+void export_arrow_array(column_batch<FieldSpecs...> batch, ArrowArray* out) {
+  detail::export_arrow_array(std::move(batch), out,
+                             std::index_sequence_for<FieldSpecs...>{});
+}
+
+// Reads up to max_rows rows (see fetch_columns) and exports them as an Arrow
+// struct array. Returns the number of rows, 0 at the end of the result.
+template <typename DbResult, typename... FieldSpecs>
+std::size_t fetch_arrow(
+    result_t<DbResult, result_row_t<FieldSpecs...>>& result,
+    ArrowArray* out,
+    std::size_t max_rows = std::numeric_limits<std::size_t>::max()) {
+  auto batch = fetch_columns(result, max_rows);
+  const auto rows = batch.size();
+  export_arrow_array(std::move(batch), out);
+  return rows;
+}
+
+// Exports the result as an Arrow stream of arrays with up to batch_size rows
+// each. The stream owns the result. The connection has to outlive the stream.
+template <typename DbResult, typename... FieldSpecs>
+void export_arrow_stream(
+    result_t<DbResult, result_row_t<FieldSpecs...>>&& result,
+    ArrowArrayStream* out,
+    std::size_t batch_size = 65536) {
+  using _result_t = result_t<DbResult, result_row_t<FieldSpecs...>>;
+  using _data_t = detail::arrow_stream_data<_result_t>;
+
+  *out = ArrowArrayStream{
+      .get_schema = [](ArrowArrayStream*, ArrowSchema* schema) -> int {
+        detail::export_arrow_schema<FieldSpecs...>(schema);
+        return 0;
+      },
+      .get_next = [](ArrowArrayStream* stream, ArrowArray* array) -> int {
+        auto& data = *static_cast<_data_t*>(stream->private_data);
+        try {
+          if (data.result.empty()) {
+            // End of stream
+            array->release = nullptr;
+            return 0;
+          }
+          fetch_arrow(data.result, array, data.batch_size);
+          return 0;
+        } catch (const std::exception& e) {
+          data.last_error = e.what();
+          return EIO;
+        }
+      },
+      .get_last_error = [](ArrowArrayStream* stream) -> const char* {
+        const auto& data = *static_cast<_data_t*>(stream->private_data);
+        return data.last_error.empty() ? nullptr : data.last_error.c_str();
+      },
+      .release =
+          [](ArrowArrayStream* stream) {
+            delete static_cast<_data_t*>(stream->private_data);
+            stream->release = nullptr;
+          },
+      .private_data = nullptr};
+  out->private_data = new _data_t{std::move(result), batch_size, {}};
+}
+}  // namespace sqlpp
@@ -0,0 +1,220 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/query/materialized_result.h>
+
+namespace sqlpp {
+namespace detail {
+// Buffers of a chunked_result, shared with the chunks handed out.
+template <typename ResultRow>
+struct chunk_pool {
+  using _buffer_t = std::unique_ptr<materialized_result<ResultRow>>;
+
+  chunk_pool(std::size_t max_in_flight, std::size_t chunk_size)
+      : max_in_flight(max_in_flight), chunk_size(chunk_size) {}
+
+  // Waits while max_in_flight buffers are in use.
+  _buffer_t acquire() {
+    std::unique_lock<std::mutex> lock{mutex};
+    cv.wait(lock, [&] { return not free.empty() or created < max_in_flight; });
+    if (free.empty()) {
+      ++created;
+      return std::make_unique<materialized_result<ResultRow>>(chunk_size);
+    }
+    auto buffer = std::move(free.back());
+    free.pop_back();
+    return buffer;
+  }
+
+  void release(_buffer_t buffer) {
+    buffer->clear();
+    {
+      std::unique_lock<std::mutex> lock{mutex};
+      free.push_back(std::move(buffer));
+    }
+    cv.notify_one();
+  }
+
+  const std::size_t max_in_flight;
+  const std::size_t chunk_size;
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<_buffer_t> free;
+  std::size_t created = 0;
+};
+}  // namespace detail
+
+// A batch of rows handed out by a chunked_result. Text and blob fields stay
+// valid while the chunk exists. Chunks can be moved to other threads. The
+// buffer is returned for reuse when the chunk is destroyed.
+template <typename ResultRow>
+class result_chunk {
+  using _pool_t = detail::chunk_pool<ResultRow>;
+
+ public:
+  using value_type = ResultRow;
+  using iterator = typename std::span<const ResultRow>::iterator;
+
+  result_chunk() = default;
+  result_chunk(std::shared_ptr<_pool_t> pool,
+               typename _pool_t::_buffer_t buffer)
+      : _pool(std::move(pool)), _buffer(std::move(buffer)) {}
+
+  result_chunk(const result_chunk&) = delete;
+  result_chunk(result_chunk&&) = default;
+  result_chunk& operator=(const result_chunk&) = delete;
+  result_chunk& operator=(result_chunk&& other) {
+    if (this != &other) {
+      release();
+      _pool = std::move(other._pool);
+      _buffer = std::move(other._buffer);
+    }
+    return *this;
+  }
+  ~result_chunk() { release(); }
+
+  // Contiguous, e.g. for parallel algorithms
+  std::span<const ResultRow> rows() const {
+    if (not _buffer or _buffer->empty()) {
+      return {};
+    }
+    return {&(*_buffer)[0], _buffer->size()};
+  }
+
+  operator std::span<const ResultRow>() const { return rows(); }
+
+  iterator begin() const { return rows().begin(); }
+
+  iterator end() const { return rows().end(); }
+
+  std::size_t size() const { return _buffer ? _buffer->size() : 0; }
+
+  bool empty() const { return size() == 0; }
+
+  const ResultRow& operator[](std::size_t index) const {
+    return (*_buffer)[index];
+  }
+
+ private:
+  void release() {
+    if (_buffer) {
+      _pool->release(std::move(_buffer));
+    }
+  }
+
+  std::shared_ptr<_pool_t> _pool;
+  typename _pool_t::_buffer_t _buffer;
+};
+
+// Input range of result_chunks with up to rows_per_chunk rows each, see
+// result_t::chunks(). At most max_in_flight chunks exist at any time:
+// Advancing the iterator waits for a chunk to be destroyed if necessary.
+// The rows of a chunk are read while other chunks are being processed.
+template <typename Result, typename ResultRow>
+class chunked_result {
+  using _row_t = ResultRow;
+  using _pool_t = detail::chunk_pool<_row_t>;
+
+ public:
+  class iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = result_chunk<_row_t>;
+    using reference = result_chunk<_row_t>&;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+    explicit iterator(chunked_result& chunks) : _chunks(&chunks) { ++*this; }
+
+    // Move the chunk to keep it, e.g. to process it on another thread.
+    reference operator*() const { return _chunk; }
+
+    iterator& operator++() {
+      _chunk = {};  // Make the buffer available before waiting for one.
+      _chunk = _chunks->next_chunk();
+      return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    bool operator==(std::default_sentinel_t) const {
+      return _chunks == nullptr or _chunks->_done;
+    }
+
+   private:
+    chunked_result* _chunks = nullptr;
+    mutable result_chunk<_row_t> _chunk;
+  };
+
+  chunked_result(Result result,
+                 std::size_t rows_per_chunk,
+                 std::size_t max_in_flight,
+                 std::size_t chunk_size)
+      : _result(std::forward<Result>(result)),
+        _rows_per_chunk(std::max<std::size_t>(rows_per_chunk, 1)),
+        _pool(std::make_shared<_pool_t>(std::max<std::size_t>(max_in_flight, 1),
+                                        chunk_size)) {}
+
+  chunked_result(const chunked_result&) = delete;
+  chunked_result(chunked_result&&) = delete;
+  chunked_result& operator=(const chunked_result&) = delete;
+  chunked_result& operator=(chunked_result&&) = delete;
+  ~chunked_result() = default;
+
+  iterator begin() { return iterator{*this}; }
+
+  std::default_sentinel_t end() { return {}; }
+
+ private:
+  result_chunk<_row_t> next_chunk() {
+    if (_result.empty()) {
+      _done = true;
+      return {};
+    }
+    auto buffer = _pool->acquire();
+    auto cursor = detail::materializing_cursor<_row_t>{*buffer};
+    _result._read_rows(cursor, _rows_per_chunk);
+    return {_pool, std::move(buffer)};
+  }
+
+  Result _result;
+  std::size_t _rows_per_chunk;
+  std::shared_ptr<_pool_t> _pool;
+  bool _done = false;
+};
+}  // namespace sqlpp
@@ -0,0 +1,350 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/query/result_row.h>
+#include <sqlpp23/core/result.h>
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp {
+namespace detail {
+template <typename T>
+struct column_element {
+  using type = T;
+};
+
+template <>
+struct column_element<bool> {
+  using type = std::uint8_t;
+};
+
+template <>
+struct column_element<std::string_view> {
+  using type = char;
+};
+
+template <>
+struct column_element<std::span<const std::uint8_t>> {
+  using type = std::uint8_t;
+};
+
+template <std::size_t index, typename FieldSpec>
+struct batch_column;
+}  // namespace detail
+
+// The values of one result column in contiguous buffers, see fetch_columns.
+//
+// Fixed width values are stored in values(), one per row (bool as uint8_t).
+// Text and blob values are stored back to back in data(), row i spanning
+// [offsets()[i], offsets()[i + 1]). For nullable columns, bit i of validity()
+// is set if row i is not NULL (least significant bit first). The value of a
+// NULL row is value-initialized or empty.
+template <typename ResultType>
+class column_buffer {
+  template <std::size_t, typename>
+  friend struct detail::batch_column;
+
+  using _value_t = remove_optional_t<ResultType>;
+  using _element_t = typename detail::column_element<_value_t>::type;
+
+ public:
+  using value_type = ResultType;
+  static constexpr bool is_nullable = is_optional<ResultType>::value;
+  static constexpr bool is_variable_width =
+      std::is_same_v<_value_t, std::string_view> or
+      std::is_same_v<_value_t, std::span<const std::uint8_t>>;
+
+  std::size_t size() const { return _size; }
+
+  bool empty() const { return _size == 0; }
+
+  bool is_null(std::size_t row) const {
+    if constexpr (is_nullable) {
+      return not((_validity[row / 8] >> (row % 8)) & 1u);
+    } else {
+      return false;
+    }
+  }
+
+  // Text and blob values point into data().
+  value_type operator[](std::size_t row) const {
+    if constexpr (is_nullable) {
+      if (is_null(row)) {
+        return std::nullopt;
+      }
+    }
+    if constexpr (is_variable_width) {
+      return _value_t{_data.data() + _offsets[row],
+                      static_cast<std::size_t>(_offsets[row + 1] -
+                                               _offsets[row])};
+    } else {
+      return static_cast<_value_t>(_values[row]);
+    }
+  }
+
+  std::span<const _element_t> values() const
+    requires(not is_variable_width)
+  {
+    return _values;
+  }
+
+  std::span<const std::int64_t> offsets() const
+    requires(is_variable_width)
+  {
+    return _offsets;
+  }
+
+  std::span<const _element_t> data() const
+    requires(is_variable_width)
+  {
+    return _data;
+  }
+
+  std::span<const std::uint8_t> validity() const { return _validity; }
+
+  void clear() {
+    _size = 0;
+    _values.clear();
+    _offsets.assign(1, 0);
+    _data.clear();
+    _validity.clear();
+  }
+
+  void reserve(std::size_t rows) {
+    if constexpr (is_variable_width) {
+      _offsets.reserve(rows + 1);
+    } else {
+      _values.reserve(rows);
+    }
+    if constexpr (is_nullable) {
+      _validity.reserve((rows + 7) / 8);
+    }
+  }
+
+ private:
+  void _append(const value_type& value) {
+    if constexpr (is_nullable) {
+      if (_size % 8 == 0) {
+        _validity.push_back(0);
+      }
+      if (value) {
+        _validity.back() |= static_cast<std::uint8_t>(1u << (_size % 8));
+        _append_value(*value);
+      } else {
+        _append_value(_value_t{});
+      }
+    } else {
+      _append_value(value);
+    }
+    ++_size;
+  }
+
+  void _append_value(const _value_t& value) {
+    if constexpr (is_variable_width) {
+      _data.insert(_data.end(), value.begin(), value.end());
+      _offsets.push_back(static_cast<std::int64_t>(_data.size()));
+    } else {
+      _values.push_back(static_cast<_element_t>(value));
+    }
+  }
+
+  std::size_t _size = 0;
+  std::vector<_element_t> _values;
+  std::vector<std::int64_t> _offsets = std::vector<std::int64_t>(1, 0);
+  std::vector<_element_t> _data;
+  std::vector<std::uint8_t> _validity;
+  // The connector reads (or binds) the field of the current row here.
+  value_type _field = {};
+};
+
+namespace detail {
+template <std::size_t index, typename FieldSpec>
+struct batch_column
+    : public member_t<FieldSpec,
+                      column_buffer<typename FieldSpec::result_data_type>> {
+  using _column =
+      member_t<FieldSpec, column_buffer<typename FieldSpec::result_data_type>>;
+
+ protected:
+  template <typename Target>
+  void _bind_field(Target& target) {
+    target.bind_field(index, _column::operator()()._field);
+  }
+
+  template <typename Target>
+  void _read_field(Target& target) {
+    auto& column = _column::operator()();
+    target.read_field(index, column._field);
+    column._append(column._field);
+  }
+
+  template <typename Value>
+  void _append_field(const Value& value) {
+    _column::operator()()._append(value);
+  }
+
+  void _clear() { _column::operator()().clear(); }
+
+  void _reserve(std::size_t rows) { _column::operator()().reserve(rows); }
+};
+
+template <typename IndexSequence, typename... FieldSpecs>
+struct column_batch_impl;
+
+template <std::size_t... Is, typename... FieldSpecs>
+struct column_batch_impl<std::index_sequence<Is...>, FieldSpecs...>
+    : public batch_column<Is, FieldSpecs>... {
+ protected:
+  template <typename Target>
+  void _bind_fields(Target& target) {
+    (batch_column<Is, FieldSpecs>::_bind_field(target), ...);
+  }
+
+  template <typename Target>
+  void _read_fields(Target& target) {
+    (batch_column<Is, FieldSpecs>::_read_field(target), ...);
+  }
+
+  template <typename Row>
+  void _append_row(const Row& row) {
+    const auto values = row.as_tuple();
+    (batch_column<Is, FieldSpecs>::_append_field(std::get<Is>(values)), ...);
+  }
+
+  void _clear() { (batch_column<Is, FieldSpecs>::_clear(), ...); }
+
+  void _reserve(std::size_t rows) {
+    (batch_column<Is, FieldSpecs>::_reserve(rows), ...);
+  }
+};
+}  // namespace detail
+
+// Struct of column_buffers, one per selected column, with the same member
+// names as the result row, e.g. batch.id.values().
+template <typename... FieldSpecs>
+class column_batch
+    : public detail::column_batch_impl<
+          std::make_index_sequence<sizeof...(FieldSpecs)>,
+          FieldSpecs...> {
+ public:
+  // Number of rows
+  std::size_t size() const { return _size; }
+
+  bool empty() const { return _size == 0; }
+
+  // Keeps the allocated buffers.
+  void clear() {
+    _impl::_clear();
+    _size = 0;
+  }
+
+  void reserve(std::size_t rows) { _impl::_reserve(rows); }
+
+ private:
+  template <typename Batch>
+  friend class detail::column_batch_cursor;
+  using _impl = detail::column_batch_impl<
+      std::make_index_sequence<sizeof...(FieldSpecs)>,
+      FieldSpecs...>;
+
+  std::size_t _size = 0;
+};
+
+namespace detail {
+// Stands in for the result row while the connector reads rows into a batch.
+template <typename Batch>
+class column_batch_cursor : public row_cursor {
+ public:
+  explicit column_batch_cursor(Batch& batch) : _batch(batch) {}
+
+  template <typename Target>
+  void bind_fields(Target& target) {
+    _batch._bind_fields(target);
+  }
+
+  template <typename Target>
+  void read_fields(Target& target) {
+    _batch._read_fields(target);
+    ++_batch._size;
+  }
+
+  template <typename ResultRow>
+  void append(const ResultRow& row) {
+    _batch._append_row(row);
+    ++_batch._size;
+  }
+
+  template <typename DbResult, typename ResultRow>
+  std::size_t fetch(result_t<DbResult, ResultRow>& result,
+                    std::size_t max_rows) {
+    return result._read_rows(*this, max_rows);
+  }
+
+ private:
+  Batch& _batch;
+};
+}  // namespace detail
+
+// Appends up to max_rows rows of the result to the batch, reading the fields
+// from the connector's result directly into the column buffers. Returns the
+// number of rows appended. Iteration can continue with the remaining rows.
+template <typename DbResult, typename... FieldSpecs>
+std::size_t fetch_columns(
+    result_t<DbResult, result_row_t<FieldSpecs...>>& result,
+    column_batch<FieldSpecs...>& batch,
+    std::size_t max_rows = std::numeric_limits<std::size_t>::max()) {
+  return detail::column_batch_cursor<column_batch<FieldSpecs...>>{batch}
+      .fetch(result, max_rows);
+}
+
+template <typename DbResult, typename... FieldSpecs>
+column_batch<FieldSpecs...> fetch_columns(
+    result_t<DbResult, result_row_t<FieldSpecs...>>& result,
+    std::size_t max_rows = std::numeric_limits<std::size_t>::max()) {
+  auto batch = column_batch<FieldSpecs...>{};
+  fetch_columns(result, batch, max_rows);
+  return batch;
+}
+
+template <typename DbResult, typename... FieldSpecs>
+column_batch<FieldSpecs...> fetch_columns(
+    result_t<DbResult, result_row_t<FieldSpecs...>>&& result,
+    std::size_t max_rows = std::numeric_limits<std::size_t>::max()) {
+  return fetch_columns(result, max_rows);
+}
+}  // namespace sqlpp
@@ -0,0 +1,239 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/database/prepared_select.h>
+#include <sqlpp23/core/query/result_row.h>
+#include <sqlpp23/core/query/result_struct.h>
+#include <sqlpp23/core/query/statement.h>
+#include <sqlpp23/core/query/statement_handler.h>
+#include <sqlpp23/core/type_traits.h>
+
+// Reading a single row or a single value, e.g.
+//
+//   if (const auto row =
+//           db.fetch_one(select(t.id, t.name).from(t).where(t.id == 7))) {
+//     // use row->id, row->name
+//   }
+//   const auto total = db.fetch_value(select(count(t.id).as(n)).from(t));
+//
+// The first row is read from the connector's result directly into values that
+// own their data, without a result_t, its iterator, or a result row of views.
+// Statements that can have a limit, but do not have one, get `LIMIT 1`.
+
+namespace sqlpp {
+namespace detail {
+// The type that owns the data of a result field, e.g. std::string for
+// std::string_view.
+template <typename Value>
+struct owning_value {
+  using type = Value;
+};
+
+template <>
+struct owning_value<std::string_view> {
+  using type = std::string;
+};
+
+template <>
+struct owning_value<std::span<const uint8_t>> {
+  using type = std::vector<uint8_t>;
+};
+
+template <typename Value>
+struct owning_value<std::optional<Value>> {
+  using type = std::optional<typename owning_value<Value>::type>;
+};
+
+template <typename Value>
+using owning_value_t = typename owning_value<Value>::type;
+
+template <typename FieldSpec>
+struct owning_field_spec {
+  using result_data_type =
+      owning_value_t<typename FieldSpec::result_data_type>;
+};
+
+template <typename ResultRow>
+struct owning_row;
+
+template <typename... FieldSpecs>
+struct owning_row<result_row_t<FieldSpecs...>> {
+  using type = result_row_t<owning_field_spec<FieldSpecs>...>;
+};
+}  // namespace detail
+
+template <typename FieldSpec>
+struct name_tag_of<detail::owning_field_spec<FieldSpec>>
+    : public name_tag_of<FieldSpec> {};
+
+// A result row with fields that own their data, e.g. std::string instead of
+// std::string_view for text. See fetch_one() in the connectors.
+template <typename ResultRow>
+using owning_row_t = typename detail::owning_row<ResultRow>::type;
+
+namespace detail {
+template <typename Statement>
+struct fetched_result_row {
+  using type = get_result_row_t<Statement>;
+};
+
+template <typename Database, typename Statement>
+struct fetched_result_row<prepared_select_t<Database, Statement>> {
+  using type = typename prepared_select_t<Database, Statement>::_result_row_t;
+};
+
+template <typename Statement>
+using fetched_result_row_t = typename fetched_result_row<Statement>::type;
+
+template <typename Target, typename ResultRow>
+class single_row_cursor;
+
+// Stands in for the result row while the connector reads the first row of a
+// result into an owning row or an aggregate (see result_struct.h).
+template <typename Target, typename... FieldSpecs>
+class single_row_cursor<Target, result_row_t<FieldSpecs...>>
+    : public row_cursor {
+  using _owning_row_t = owning_row_t<result_row_t<FieldSpecs...>>;
+
+ public:
+  explicit single_row_cursor(std::optional<Target>& target)
+      : _target(target) {}
+
+  template <typename DbResult>
+  void bind_fields(DbResult& result) {
+    bind_fields(result, std::index_sequence_for<FieldSpecs...>{});
+  }
+
+  template <typename DbResult>
+  void read_fields(DbResult& result) {
+    read_fields(result, std::index_sequence_for<FieldSpecs...>{});
+  }
+
+ private:
+  template <typename DbResult, std::size_t... Is>
+  void bind_fields(DbResult& result, std::index_sequence<Is...>) {
+    (result.bind_field(Is, std::get<Is>(_fields)), ...);
+  }
+
+  template <typename DbResult, std::size_t... Is>
+  void read_fields(DbResult& result, std::index_sequence<Is...>) {
+    (result.read_field(Is, std::get<Is>(_fields)), ...);
+
+    auto& target = _target.emplace();
+    if constexpr (std::is_same_v<Target, _owning_row_t>) {
+      result_row_bridge{}.validate(target);
+      (assign_member(owning_field<FieldSpecs>(target), std::get<Is>(_fields)),
+       ...);
+    } else {
+      (assign_member(struct_member<name_tag_of_t<FieldSpecs>>(target),
+                     std::get<Is>(_fields)),
+       ...);
+    }
+  }
+
+  template <typename FieldSpec>
+  static auto& owning_field(_owning_row_t& row) {
+    using _field_t =
+        member_t<owning_field_spec<FieldSpec>,
+                 owning_value_t<typename FieldSpec::result_data_type>>;
+    return static_cast<_field_t&>(row)();
+  }
+
+  std::optional<Target>& _target;
+  // The connector reads (or binds) the fields of the current row here.
+  std::tuple<typename FieldSpecs::result_data_type...> _fields;
+};
+
+// Adds `LIMIT 1` to statements that can have a limit, but do not have one.
+template <typename Statement>
+decltype(auto) limit_to_one_row(const Statement& statement) {
+  if constexpr (requires { statement.limit(1u); }) {
+    return statement.limit(1u);
+  } else {
+    return statement;
+  }
+}
+
+// Returns the first row of the result, if any. Row defaults to an owning_row_t
+// of the statement's result row. Otherwise, it is an aggregate.
+template <typename Row, typename Db, typename Statement>
+auto fetch_one(Db& db, Statement&& statement) {
+  using _result_row_t = fetched_result_row_t<std::decay_t<Statement>>;
+  using _row_t = std::conditional_t<std::is_void_v<Row>,
+                                    owning_row_t<_result_row_t>, Row>;
+
+  auto row = std::optional<_row_t>{};
+  auto cursor = single_row_cursor<_row_t, _result_row_t>{row};
+  if constexpr (is_prepared_statement_v<std::decay_t<Statement>>) {
+    statement_handler_t{}.run_prepared_fetch_one(statement, db, cursor);
+  } else {
+    decltype(auto) limited = limit_to_one_row(statement);
+    check_run_consistency(limited).verify();
+    check_compatibility<typename Db::_context_t>(limited).verify();
+    statement_handler_t{}.fetch_one(limited, db, cursor);
+  }
+  return row;
+}
+
+template <typename ResultRow>
+struct single_field;
+
+template <typename FieldSpec>
+struct single_field<result_row_t<FieldSpec>> {
+  using type = owning_value_t<typename FieldSpec::result_data_type>;
+  using _field_t = member_t<owning_field_spec<FieldSpec>, type>;
+};
+
+// Returns the value of the single column in the first row of the result, if
+// any. The value is a std::optional itself if the column can be NULL.
+template <typename Db, typename Statement>
+auto fetch_value(Db& db, Statement&& statement) {
+  using _field =
+      single_field<fetched_result_row_t<std::decay_t<Statement>>>;
+  using _value_t = typename _field::type;
+
+  auto row = fetch_one<void>(db, std::forward<Statement>(statement));
+  if (not row) {
+    return std::optional<_value_t>{};
+  }
+  return std::optional<_value_t>{
+      std::move(static_cast<typename _field::_field_t&>(*row)())};
+}
+}  // namespace detail
+}  // namespace sqlpp
@@ -0,0 +1,200 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <bitset>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <sqlpp23/core/query/result_row.h>
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp {
+namespace detail {
+template <typename NameTag, typename... FieldSpecs>
+constexpr std::size_t lazy_field_index() {
+  constexpr bool matches[] = {
+      std::is_same_v<name_tag_of_t<FieldSpecs>, NameTag>..., false};
+  for (std::size_t index = 0; index < sizeof...(FieldSpecs); ++index) {
+    if (matches[index]) {
+      return index;
+    }
+  }
+  return sizeof...(FieldSpecs);
+}
+}  // namespace detail
+
+template <typename DbResult, typename ResultRow>
+class lazy_row;
+
+// A result row that reads its fields from the connector's result when they are
+// first accessed. Fields that are never accessed are never converted, e.g.
+// timestamps that would have to be parsed. See result_t::lazy().
+template <typename DbResult, typename... FieldSpecs>
+class lazy_row<DbResult, result_row_t<FieldSpecs...>>
+    : public detail::row_cursor {
+  using _row_t = result_row_t<FieldSpecs...>;
+
+ public:
+  explicit lazy_row(DbResult& result) : _result(&result) {}
+
+  lazy_row(const lazy_row&) = delete;
+  lazy_row(lazy_row&&) = delete;
+  lazy_row& operator=(const lazy_row&) = delete;
+  lazy_row& operator=(lazy_row&&) = delete;
+  ~lazy_row() = default;
+
+  // Returns the field with the name of the column or alias, e.g.
+  // `row.get(tab.id)`.
+  template <typename NameTagProvider>
+  const auto& get(const NameTagProvider& /*unused*/) const {
+    constexpr auto index =
+        detail::lazy_field_index<name_tag_of_t<NameTagProvider>,
+                                 FieldSpecs...>();
+    static_assert(index < sizeof...(FieldSpecs),
+                  "the result row has no field with this name");
+    return field<index>();
+  }
+
+  // Reads the remaining fields and returns the complete row.
+  const _row_t& row() const {
+    read_all(std::index_sequence_for<FieldSpecs...>{});
+    return _row;
+  }
+
+  // Takes over a row that has been read completely.
+  void assign(_row_t&& row) {
+    if (row) {
+      validate();
+    }
+    _row = std::move(row);
+    _read.set();
+  }
+
+  template <typename Target>
+  void bind_fields(Target& target) {
+    detail::result_row_bridge{}.bind_fields(_row, target);
+  }
+
+  // Called by the connector for each row. Fields are read later.
+  template <typename Target>
+  void read_fields(Target& /*unused*/) {
+    _read.reset();
+  }
+
+ private:
+  template <std::size_t Index>
+  const auto& field() const {
+    using _field_spec_t =
+        std::tuple_element_t<Index, std::tuple<FieldSpecs...>>;
+    using _field_t =
+        member_t<_field_spec_t, typename _field_spec_t::result_data_type>;
+    auto& value = static_cast<_field_t&>(_row)();
+    if (not _read.test(Index)) {
+      _result->read_field(Index, value);
+      _read.set(Index);
+    }
+    return value;
+  }
+
+  template <std::size_t... Is>
+  void read_all(std::index_sequence<Is...>) const {
+    (field<Is>(), ...);
+  }
+
+  DbResult* _result;
+  mutable _row_t _row;
+  mutable std::bitset<sizeof...(FieldSpecs)> _read;
+};
+
+// The rows of a result as lazy_rows. The first row has been read completely by
+// the result already.
+template <typename DbResult, typename ResultRow>
+class lazy_result {
+ public:
+  using row_type = lazy_row<DbResult, ResultRow>;
+
+  class iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = row_type;
+    using pointer = const row_type*;
+    using reference = const row_type&;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+    explicit iterator(lazy_result& result) : _result(&result) {}
+
+    reference operator*() const { return _result->front(); }
+
+    pointer operator->() const { return &_result->front(); }
+
+    iterator& operator++() {
+      _result->pop_front();
+      return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    bool operator==(std::default_sentinel_t) const {
+      return _result == nullptr or _result->empty();
+    }
+
+   private:
+    lazy_result* _result = nullptr;
+  };
+
+  lazy_result(DbResult&& result, ResultRow&& first_row)
+      : _result(std::move(result)), _row(_result) {
+    _row.assign(std::move(first_row));
+  }
+
+  // The rows refer to the result.
+  lazy_result(const lazy_result&) = delete;
+  lazy_result(lazy_result&&) = delete;
+  lazy_result& operator=(const lazy_result&) = delete;
+  lazy_result& operator=(lazy_result&&) = delete;
+  ~lazy_result() = default;
+
+  iterator begin() { return iterator{*this}; }
+
+  std::default_sentinel_t end() { return {}; }
+
+  const row_type& front() const { return _row; }
+
+  bool empty() const { return not _row; }
+
+  void pop_front() { _result.next(_row); }
+
+ private:
+  DbResult _result;
+  row_type _row;
+};
+}  // namespace sqlpp
@@ -0,0 +1,155 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/detail/arena.h>
+#include <sqlpp23/core/query/result_row.h>
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp {
+namespace detail {
+template <typename Value>
+Value copy_to_arena(arena& a, const Value& value) {
+  if constexpr (is_optional<Value>::value) {
+    if (value.has_value()) {
+      return copy_to_arena(a, *value);
+    }
+    return std::nullopt;
+  } else if constexpr (std::is_same_v<Value, std::string_view> or
+                       std::is_same_v<Value, std::span<const uint8_t>>) {
+    return a.copy(value);
+  } else {
+    return value;
+  }
+}
+
+template <typename ResultRow>
+class materializing_cursor;
+}  // namespace detail
+
+// All rows of a result, with text and blob fields copied into an arena owned
+// by the materialized_result. Rows and their fields stay valid until the
+// materialized_result is destroyed. See result_t::materialize().
+template <typename ResultRow>
+class materialized_result {
+  template <typename>
+  friend class detail::materializing_cursor;
+
+ public:
+  using value_type = ResultRow;
+  using const_iterator = typename std::vector<ResultRow>::const_iterator;
+  using iterator = const_iterator;
+
+  explicit materialized_result(std::size_t chunk_size) : _arena(chunk_size) {}
+
+  materialized_result(const materialized_result&) = delete;
+  materialized_result(materialized_result&&) = default;
+  materialized_result& operator=(const materialized_result&) = delete;
+  materialized_result& operator=(materialized_result&&) = default;
+  ~materialized_result() = default;
+
+  const_iterator begin() const { return _rows.begin(); }
+
+  const_iterator end() const { return _rows.end(); }
+
+  std::size_t size() const { return _rows.size(); }
+
+  bool empty() const { return _rows.empty(); }
+
+  const ResultRow& operator[](std::size_t index) const { return _rows[index]; }
+
+  const ResultRow& front() const { return _rows.front(); }
+
+  const ResultRow& back() const { return _rows.back(); }
+
+  // Bytes allocated for text and blob fields
+  std::size_t arena_capacity() const { return _arena.capacity(); }
+
+  // Removes the rows, keeping the memory for reuse.
+  void clear() {
+    _rows.clear();
+    _arena.clear();
+  }
+
+ private:
+  detail::arena _arena;
+  std::vector<ResultRow> _rows;
+};
+
+namespace detail {
+// Stands in for the result row while the connector reads rows into a
+// materialized_result.
+template <typename... FieldSpecs>
+class materializing_cursor<result_row_t<FieldSpecs...>> : public row_cursor {
+  using _row_t = result_row_t<FieldSpecs...>;
+
+ public:
+  explicit materializing_cursor(materialized_result<_row_t>& result)
+      : _result(result) {}
+
+  void reserve(std::size_t rows) { _result._rows.reserve(rows); }
+
+  template <typename Target>
+  void bind_fields(Target& target) {
+    result_row_bridge{}.bind_fields(_row, target);
+  }
+
+  template <typename Target>
+  void read_fields(Target& target) {
+    result_row_bridge{}.read_fields(_row, target);
+    append(_row);
+  }
+
+  void append(const _row_t& row) {
+    auto& copy = _result._rows.emplace_back();
+    result_row_bridge{}.validate(copy);
+    (copy_field<FieldSpecs>(copy, row), ...);
+  }
+
+ private:
+  template <typename FieldSpec>
+  void copy_field(_row_t& target, const _row_t& source) {
+    using _field_t = member_t<FieldSpec, typename FieldSpec::result_data_type>;
+    static_cast<_field_t&>(target)() = copy_to_arena(
+        _result._arena, static_cast<const _field_t&>(source)());
+  }
+
+  materialized_result<_row_t>& _result;
+  // The connector reads (or binds) the fields of the current row here.
+  _row_t _row;
+};
+}  // namespace detail
+}  // namespace sqlpp
@@ -0,0 +1,217 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/detail/circular_buffer.h>
+#include <sqlpp23/core/query/materialized_result.h>
+
+namespace sqlpp {
+// Reads the rows of a result on a helper thread, into a bounded ring of
+// batches, while the calling thread processes earlier rows. Text and blob
+// fields are copied, so rows are valid until the iteration moves past them.
+//
+// The result's connection must not be used by the calling thread until the
+// prefetching_result is destroyed.
+template <typename Result>
+class prefetching_result {
+  using _row_t =
+      std::remove_cvref_t<decltype(std::declval<const Result&>().front())>;
+  using _batch_t = std::unique_ptr<materialized_result<_row_t>>;
+
+ public:
+  class iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = _row_t;
+    using pointer = const _row_t*;
+    using reference = const _row_t&;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+    explicit iterator(prefetching_result& result) : _result(&result) {}
+
+    reference operator*() const { return _result->front(); }
+
+    pointer operator->() const { return &_result->front(); }
+
+    iterator& operator++() {
+      _result->pop_front();
+      return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    bool operator==(std::default_sentinel_t) const {
+      return _result == nullptr or _result->empty();
+    }
+
+   private:
+    prefetching_result* _result = nullptr;
+  };
+
+  // Reads batches of rows_per_batch rows. At most max_batches batches are
+  // read ahead.
+  explicit prefetching_result(Result&& result,
+                              std::size_t rows_per_batch = 256,
+                              std::size_t max_batches = 4)
+      : _result(std::move(result)),
+        _rows_per_batch(std::max<std::size_t>(rows_per_batch, 1)),
+        _filled(std::max<std::size_t>(max_batches, 1)),
+        _thread([this](std::stop_token stop) { fetch(stop); }) {}
+
+  prefetching_result(const prefetching_result&) = delete;
+  prefetching_result(prefetching_result&&) = delete;
+  prefetching_result& operator=(const prefetching_result&) = delete;
+  prefetching_result& operator=(prefetching_result&&) = delete;
+  // Stops reading after the current batch.
+  ~prefetching_result() = default;
+
+  iterator begin() { return iterator{*this}; }
+
+  std::default_sentinel_t end() { return {}; }
+
+  // Waits for the next batch if necessary. Rethrows exceptions of the helper
+  // thread.
+  bool empty() {
+    return (_batch and _index < _batch->size()) ? false : not next_batch();
+  }
+
+  const _row_t& front() {
+    empty();
+    return (*_batch)[_index];
+  }
+
+  void pop_front() {
+    if (not empty()) {
+      ++_index;
+    }
+  }
+
+ private:
+  bool next_batch() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    if (_batch) {
+      _free.push_back(std::move(_batch));
+      _cv.notify_all();
+    }
+    _cv.wait(lock, [&] { return not _filled.empty() or _done; });
+    if (_filled.empty()) {
+      if (_error) {
+        std::rethrow_exception(std::exchange(_error, nullptr));
+      }
+      return false;
+    }
+    _batch = std::move(_filled.front());
+    _filled.pop_front();
+    _index = 0;
+    _cv.notify_all();
+    return true;
+  }
+
+  void fetch(std::stop_token stop) {
+    auto batch = _batch_t{};
+    try {
+      for (;;) {
+        batch = _batch_t{};
+        {
+          std::unique_lock<std::mutex> lock{_mutex};
+          // One batch more than the ring holds is read by the consumer.
+          _cv.wait(lock, stop, [&] {
+            return not _filled.full() and
+                   (not _free.empty() or _created <= _filled.capacity());
+          });
+          if (stop.stop_requested()) {
+            return;
+          }
+          if (_free.empty()) {
+            ++_created;
+            batch = std::make_unique<materialized_result<_row_t>>(64 * 1024);
+          } else {
+            batch = std::move(_free.back());
+            _free.pop_back();
+          }
+        }
+        batch->clear();
+        auto cursor = detail::materializing_cursor<_row_t>{*batch};
+        _result._read_rows(cursor, _rows_per_batch);
+
+        std::unique_lock<std::mutex> lock{_mutex};
+        if (not batch->empty()) {
+          _filled.push_back(std::move(batch));
+        }
+        if (_result.empty()) {
+          _done = true;
+        }
+        _cv.notify_all();
+        if (_done) {
+          return;
+        }
+      }
+    } catch (...) {
+      std::unique_lock<std::mutex> lock{_mutex};
+      // The rows read before the error are handed out first.
+      if (batch and not batch->empty()) {
+        _filled.push_back(std::move(batch));
+      }
+      _error = std::current_exception();
+      _done = true;
+      _cv.notify_all();
+    }
+  }
+
+  Result _result;
+  const std::size_t _rows_per_batch;
+
+  std::mutex _mutex;
+  std::condition_variable_any _cv;
+  detail::circular_buffer<_batch_t> _filled;
+  std::vector<_batch_t> _free;
+  std::size_t _created = 0;
+  bool _done = false;
+  std::exception_ptr _error;
+
+  // Used by the calling thread only
+  _batch_t _batch;
+  std::size_t _index = 0;
+
+  // Declared last, so that it is stopped and joined first.
+  std::jthread _thread;
+};
+}  // namespace sqlpp
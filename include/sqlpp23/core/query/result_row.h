@@ -27,6 +27,7 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <type_traits>
 #include <utility>
 
 #include <sqlpp23/core/field_spec.h>
@@ -78,6 +79,20 @@ struct result_row_impl<std::index_sequence<Is...>, FieldSpecs...>
 };
 
 class result_row_bridge;
+
+// Base of objects that stand in for the result row while the connector reads
+// rows, e.g. into a column_batch.
+class row_cursor {
+ public:
+  explicit operator bool() const { return _is_valid; }
+
+  void validate() { _is_valid = true; }
+
+  void invalidate() { _is_valid = false; }
+
+ private:
+  bool _is_valid = false;
+};
 }  // namespace detail
 
 template <typename... FieldSpecs>
@@ -141,6 +156,26 @@ class result_row_bridge {
 
   template<typename... FieldSpecs>
   void invalidate(result_row_t<FieldSpecs...>& row) { row._invalidate(); }
+
+  template<typename Cursor, typename Target>
+    requires(std::is_base_of_v<row_cursor, Cursor>)
+  void bind_fields(Cursor& cursor, Target& target) {
+    cursor.bind_fields(target);
+  }
+
+  template<typename Cursor, typename Target>
+    requires(std::is_base_of_v<row_cursor, Cursor>)
+  void read_fields(Cursor& cursor, Target& target) {
+    cursor.read_fields(target);
+  }
+
+  template<typename Cursor>
+    requires(std::is_base_of_v<row_cursor, Cursor>)
+  void validate(Cursor& cursor) { cursor.validate(); }
+
+  template<typename Cursor>
+    requires(std::is_base_of_v<row_cursor, Cursor>)
+  void invalidate(Cursor& cursor) { cursor.invalidate(); }
 };
 }  // namespace detail
 
@@ -0,0 +1,142 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/query/result_row.h>
+#include <sqlpp23/core/type_traits.h>
+#include <sqlpp23/core/wrong.h>
+
+// Reading results into aggregates, e.g.
+//
+//   struct user {
+//     int64_t id;
+//     std::string name;
+//     std::optional<std::string> email;
+//   };
+//   auto users = db(select(t.id, t.name, t.email).from(t).where(true))
+//                    .into_vector<user>();
+//
+// Each selected column is stored in the member with the C++ name of its name
+// tag. Fields are read from the connector's result and assigned to the members
+// without an intermediate result row.
+
+namespace sqlpp::detail {
+// The member of the aggregate with the C++ name of the name tag. The name tag's
+// member accessor deduces the type of the object it is called on.
+template <typename NameTag, typename Struct>
+auto& struct_member(Struct& s) {
+  constexpr auto get =
+      &NameTag::template _member_t<int>::template operator()<Struct&>;
+  return get(s);
+}
+
+template <typename Member, typename Field>
+void assign_member(Member& member, const Field& field) {
+  if constexpr (is_optional<Field>::value) {
+    if constexpr (is_optional<Member>::value) {
+      if (field.has_value()) {
+        assign_member(member.emplace(), *field);
+      } else {
+        member.reset();
+      }
+    } else {
+      static_assert(
+          ::sqlpp::wrong<Member>,
+          "a column that can be NULL requires a std::optional member");
+    }
+  } else if constexpr (is_optional<Member>::value) {
+    assign_member(member.emplace(), field);
+  } else if constexpr (std::is_same_v<Member, std::string_view> or
+                       std::is_same_v<Member, std::span<const uint8_t>>) {
+    static_assert(::sqlpp::wrong<Member>,
+                  "text and blob members need to own their data, e.g. "
+                  "std::string or std::vector<uint8_t>");
+  } else if constexpr (std::is_same_v<Field, std::span<const uint8_t>>) {
+    member.assign(field.begin(), field.end());
+  } else {
+    member = field;
+  }
+}
+
+template <typename Struct, typename ResultRow>
+class struct_cursor;
+
+// Stands in for the result row while the connector reads rows into a vector
+// of aggregates.
+template <typename Struct, typename... FieldSpecs>
+class struct_cursor<Struct, result_row_t<FieldSpecs...>> : public row_cursor {
+ public:
+  explicit struct_cursor(std::vector<Struct>& rows) : _rows(rows) {}
+
+  template <typename Target>
+  void bind_fields(Target& target) {
+    bind_fields(target, std::index_sequence_for<FieldSpecs...>{});
+  }
+
+  template <typename Target>
+  void read_fields(Target& target) {
+    read_fields(target, std::index_sequence_for<FieldSpecs...>{});
+  }
+
+  void append(const result_row_t<FieldSpecs...>& row) {
+    append(row.as_tuple(), std::index_sequence_for<FieldSpecs...>{});
+  }
+
+ private:
+  template <typename Target, std::size_t... Is>
+  void bind_fields(Target& target, std::index_sequence<Is...>) {
+    (target.bind_field(Is, std::get<Is>(_fields)), ...);
+  }
+
+  template <typename Target, std::size_t... Is>
+  void read_fields(Target& target, std::index_sequence<Is...>) {
+    (target.read_field(Is, std::get<Is>(_fields)), ...);
+    append(_fields, std::index_sequence_for<FieldSpecs...>{});
+  }
+
+  template <typename Fields, std::size_t... Is>
+  void append(const Fields& fields, std::index_sequence<Is...>) {
+    auto& s = _rows.emplace_back();
+    (assign_member(struct_member<name_tag_of_t<FieldSpecs>>(s),
+                   std::get<Is>(fields)),
+     ...);
+  }
+
+  std::vector<Struct>& _rows;
+  // The connector reads (or binds) the fields of the current row here.
+  std::tuple<typename FieldSpecs::result_data_type...> _fields;
+};
+}  // namespace sqlpp::detail
@@ -63,6 +63,12 @@ class statement_handler_t {
     return db._select(std::forward<Statement>(statement));
   }
 
+  // Reads the first row of the result via the cursor, see fetch.h.
+  template <typename Statement, typename Db, typename Cursor>
+  void fetch_one(Statement&& statement, Db& db, Cursor& cursor) {
+    db._select(std::forward<Statement>(statement)).next(cursor);
+  }
+
   template <typename Statement, typename Db>
   auto update(Statement&& statement, Db& db) {
     return db._update(std::forward<Statement>(statement));
@@ -113,6 +119,11 @@ class statement_handler_t {
     return db._run_prepared_select(std::forward<Statement>(statement));
   }
 
+  template <typename Statement, typename Db, typename Cursor>
+  void run_prepared_fetch_one(Statement&& statement, Db& db, Cursor& cursor) {
+    db._run_prepared_select(std::forward<Statement>(statement)).next(cursor);
+  }
+
   template <typename Statement, typename Db>
   auto run_prepared_update(Statement&& statement, Db& db) {
     return db._run_prepared_update(std::forward<Statement>(statement));
@@ -27,8 +27,15 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <cstddef>
 #include <iterator>
 #include <utility>
+#include <vector>
+
+#include <sqlpp23/core/query/lazy_result.h>
+#include <sqlpp23/core/query/materialized_result.h>
+#include <sqlpp23/core/query/result_row.h>
+#include <sqlpp23/core/query/result_struct.h>
 
 namespace sqlpp {
 namespace detail {
@@ -51,8 +58,15 @@ struct result_size_type<
     std::void_t<decltype(std::declval<DbResult>().size())>> {
   using type = decltype(std::declval<DbResult>().size());
 };
+
+template <typename Batch>
+class column_batch_cursor;
 }  // namespace detail
 
+// See <sqlpp23/core/query/chunked_result.h>, which is required for chunks().
+template <typename Result, typename ResultRow>
+class chunked_result;
+
 template <typename DbResult, typename ResultRow>
 class result_t {
   using db_result_t = DbResult;
@@ -63,6 +77,38 @@ class result_t {
   db_result_t _end;
   result_row_t _end_row;
 
+  template <typename Batch>
+  friend class detail::column_batch_cursor;
+  template <typename Result, typename Row>
+  friend class chunked_result;
+  template <typename Result>
+  friend class prefetching_result;
+
+  // Reads up to max_rows rows via the cursor, starting with the current row.
+  // Afterwards, the current row is the first row that was not read.
+  template <typename Cursor>
+  std::size_t _read_rows(Cursor& cursor, std::size_t max_rows) {
+    if (max_rows == 0 or empty()) {
+      return 0;
+    }
+    // The current row has been read already.
+    cursor.append(_result_row);
+    auto rows = std::size_t{1};
+
+    cursor.validate();
+    while (rows < max_rows) {
+      _result.next(cursor);
+      if (not cursor) {
+        // Do not step beyond the end of the native result.
+        detail::result_row_bridge{}.invalidate(_result_row);
+        return rows;
+      }
+      ++rows;
+    }
+    _result.next(_result_row);
+    return rows;
+  }
+
  public:
   result_t() = default;
 
@@ -134,6 +180,54 @@ class result_t {
 
   void pop_front() { _result.next(_result_row); }
 
+  // Reads fields of the following rows only when they are accessed, see
+  // lazy_row. The lazy_result takes ownership of the result.
+  lazy_result<DbResult, result_row_t> lazy() && {
+    return {std::move(_result), std::move(_result_row)};
+  }
+
+  // Reads the remaining rows into aggregates, see result_struct.h.
+  template <typename Struct>
+  std::vector<Struct> into_vector() {
+    auto rows = std::vector<Struct>{};
+    if constexpr (detail::result_has_size<DbResult>::value) {
+      rows.reserve(static_cast<std::size_t>(_result.size()));
+    }
+    auto cursor = detail::struct_cursor<Struct, result_row_t>{rows};
+    _read_rows(cursor, static_cast<std::size_t>(-1));
+    return rows;
+  }
+
+  // Reads the remaining rows, copying text and blob fields into an arena with
+  // chunks of chunk_size bytes. The rows stay valid after the result is gone.
+  materialized_result<result_row_t> materialize(
+      std::size_t chunk_size = 64 * 1024) {
+    auto rows = materialized_result<result_row_t>{chunk_size};
+    auto cursor = detail::materializing_cursor<result_row_t>{rows};
+    if constexpr (detail::result_has_size<DbResult>::value) {
+      cursor.reserve(static_cast<std::size_t>(_result.size()));
+    }
+    _read_rows(cursor, static_cast<std::size_t>(-1));
+    return rows;
+  }
+
+  // Reads the rows in chunks of up to rows_per_chunk rows, with at most
+  // max_in_flight chunks at a time, see chunked_result.
+  chunked_result<result_t&, result_row_t> chunks(
+      std::size_t rows_per_chunk,
+      std::size_t max_in_flight = 2,
+      std::size_t chunk_size = 64 * 1024) & {
+    return {*this, rows_per_chunk, max_in_flight, chunk_size};
+  }
+
+  // The chunked_result takes ownership of the result.
+  chunked_result<result_t, result_row_t> chunks(
+      std::size_t rows_per_chunk,
+      std::size_t max_in_flight = 2,
+      std::size_t chunk_size = 64 * 1024) && {
+    return {std::move(*this), rows_per_chunk, max_in_flight, chunk_size};
+  }
+
   template <class Size = typename detail::result_size_type<DbResult>::type>
   Size size() const {
     static_assert(detail::result_has_size<DbResult>::value,
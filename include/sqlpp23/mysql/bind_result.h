@@ -27,9 +27,11 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <memory>
 #include <optional>
 #include <span>
 #include <string_view>
+#include <vector>
 
 #include <sqlpp23/core/chrono.h>
 #include <sqlpp23/core/query/result_row.h>
@@ -38,25 +40,38 @@
 #include <sqlpp23/mysql/sqlpp_mysql.h>
 
 namespace sqlpp::mysql {
-class bind_result_t {
-  struct bind_result_buffer {
-    unsigned long length;
-    my_bool is_null;
-    my_bool error;
-    union  // unnamed union injects members into scope
-    {
-      bool bool_;
-      int64_t int64_;
-      uint64_t uint64_;
-      double double_;
-      MYSQL_TIME mysql_time_;
-    };
-    std::vector<char> var_buffer;  // text and blobs
+namespace detail {
+struct bind_result_buffer {
+  unsigned long length;
+  my_bool is_null;
+  my_bool error;
+  union  // unnamed union injects members into scope
+  {
+    bool bool_;
+    int64_t int64_;
+    uint64_t uint64_;
+    double double_;
+    MYSQL_TIME mysql_time_;
   };
+  std::vector<char> var_buffer;  // text and blobs
+};
+
+// Result buffers of a prepared statement, handed back by each bind_result_t of
+// the statement when it is destroyed. Text and blob buffers keep their size, so
+// that repeated executions stop allocating.
+struct result_buffers {
+  std::vector<MYSQL_BIND> params;
+  std::vector<bind_result_buffer> buffers;
+};
+}  // namespace detail
+
+class bind_result_t {
+  using bind_result_buffer = detail::bind_result_buffer;
 
   std::shared_ptr<MYSQL_STMT> _mysql_stmt;
   std::vector<MYSQL_BIND> _result_params;
   std::vector<bind_result_buffer> _result_buffers;
+  std::shared_ptr<detail::result_buffers> _reusable_buffers;
   const connection_config* _config;
   void* _result_row_address{nullptr};
   bool _require_bind = true;
@@ -82,6 +97,24 @@ class bind_result_t {
       }
     }
   }
+  // Takes the buffers of a previous execution of the prepared statement, if
+  // they are available.
+  bind_result_t(const std::shared_ptr<MYSQL_STMT>& mysql_stmt,
+                size_t no_of_columns,
+                std::shared_ptr<detail::result_buffers> reusable_buffers,
+                const connection_config* config)
+      : bind_result_t{mysql_stmt, 0, config} {
+    _reusable_buffers = std::move(reusable_buffers);
+    if (_reusable_buffers and
+        _reusable_buffers->buffers.size() == no_of_columns) {
+      _result_params = std::move(_reusable_buffers->params);
+      _result_buffers = std::move(_reusable_buffers->buffers);
+    } else {
+      _result_params.resize(no_of_columns, MYSQL_BIND{});
+      _result_buffers.resize(no_of_columns, bind_result_buffer{});
+    }
+  }
+
   bind_result_t(const bind_result_t&) = delete;
   bind_result_t(bind_result_t&& rhs) = default;
   bind_result_t& operator=(const bind_result_t&) = delete;
@@ -89,6 +122,10 @@ class bind_result_t {
   ~bind_result_t() {
     if (_mysql_stmt)
       mysql_stmt_free_result(_mysql_stmt.get());
+    if (_reusable_buffers and not _result_buffers.empty()) {
+      _reusable_buffers->params = std::move(_result_params);
+      _reusable_buffers->buffers = std::move(_result_buffers);
+    }
   }
 
   bool operator==(const bind_result_t& rhs) const {
@@ -63,4 +63,20 @@ struct compatibility_check<mysql::context_t, cast_t<Expression, Type>> {
   using type = mysql::assert_no_bool_cast;
 };
 
+namespace mysql {
+class assert_no_array_parameter_t : public wrapped_static_assert {
+ public:
+  template <typename... T>
+  static void verify(T&&...) {
+    static_assert(wrong<T...>, "MySQL: No support for array parameters");
+  }
+};
+}  // namespace mysql
+
+template <typename DataType, typename NameTag>
+struct compatibility_check<mysql::context_t,
+                           array_parameter_t<DataType, NameTag>> {
+  using type = mysql::assert_no_array_parameter_t;
+};
+
 }  // namespace sqlpp
@@ -32,6 +32,7 @@
 #include <string>
 
 #include <sqlpp23/core/database/connection.h>
+#include <sqlpp23/core/query/fetch.h>
 #include <sqlpp23/core/query/statement.h>
 #include <sqlpp23/core/query/statement_handler.h>
 #include <sqlpp23/core/to_sql_string.h>
@@ -139,6 +140,7 @@ class connection_base : public sqlpp::connection {
   using _handle_t = detail::connection_handle;
 
   using _prepared_statement_t = ::sqlpp::mysql::prepared_statement_t;
+  using _context_t = context_t;
 
  private:
   friend sqlpp::statement_handler_t;
@@ -200,7 +202,12 @@ class connection_base : public sqlpp::connection {
       prepared_statement_t& prepared_statement,
       size_t no_of_columns) {
     detail::execute_prepared_statement(prepared_statement);
+    if (not prepared_statement._result_buffers) {
+      prepared_statement._result_buffers =
+          std::make_shared<detail::result_buffers>();
+    }
     return bind_result_t{prepared_statement.native_handle(), no_of_columns,
+                         prepared_statement._result_buffers,
                          _handle.config.get()};
   }
 
@@ -372,6 +379,23 @@ class connection_base : public sqlpp::connection {
     return sqlpp::statement_handler_t{}.prepare(t, *this);
   }
 
+  //! fetch_one returns the first row of a select, if any, with fields that own
+  //! their data. With a Row type, the row is read into that aggregate instead,
+  //! see core/query/fetch.h.
+  template <typename Row = void, typename T>
+    requires(sqlpp::no_of_result_columns<std::decay_t<T>>::value > 0)
+  auto fetch_one(T&& t) {
+    return sqlpp::detail::fetch_one<Row>(*this, std::forward<T>(t));
+  }
+
+  //! fetch_value returns the value of the single column of the first row of a
+  //! select, if any.
+  template <typename T>
+    requires(sqlpp::no_of_result_columns<std::decay_t<T>>::value == 1)
+  auto fetch_value(T&& t) {
+    return sqlpp::detail::fetch_value(*this, std::forward<T>(t));
+  }
+
   //! start transaction
   void start_transaction() {
     execute_statement(_handle, "START TRANSACTION");
@@ -28,8 +28,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp23/core/database/connection_pool.h>
+#include <sqlpp23/core/database/routing_pool.h>
+#include <sqlpp23/core/database/sharded_pool.h>
 #include <sqlpp23/mysql/database/connection.h>
 
 namespace sqlpp::mysql {
 using connection_pool = sqlpp::connection_pool<connection_base>;
+using routing_pool = sqlpp::routing_pool<connection_base>;
+template <typename Key = std::int64_t>
+using sharded_pool = sqlpp::sharded_pool<connection_base, Key>;
 }  // namespace sqlpp::mysql
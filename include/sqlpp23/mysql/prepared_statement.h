@@ -48,6 +48,9 @@ struct wrapped_bool {
   ~wrapped_bool() = default;
 };
 
+// See bind_result.h
+struct result_buffers;
+
 }  // namespace detail
 
 class connection_base;
@@ -60,6 +63,8 @@ class prepared_statement_t {
   std::vector<MYSQL_TIME> stmt_date_time_param_buffer;
   std::vector<detail::wrapped_bool>
       stmt_param_is_null;  // my_bool is bool after 8.0, and vector<bool> is bad
+  // Reused by the results of each execution
+  std::shared_ptr<detail::result_buffers> _result_buffers;
   const connection_config* _config;
 
  public:
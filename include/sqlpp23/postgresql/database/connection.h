@@ -35,6 +35,7 @@
 #include <sqlpp23/core/database/connection.h>
 #include <sqlpp23/core/database/exception.h>
 #include <sqlpp23/core/database/transaction.h>
+#include <sqlpp23/core/query/fetch.h>
 #include <sqlpp23/core/query/statement_constructor_arg.h>
 #include <sqlpp23/core/to_sql_string.h>
 #include <sqlpp23/postgresql/database/connection_config.h>
@@ -87,6 +88,7 @@ class connection_base : public sqlpp::connection {
   using _handle_t = detail::connection_handle;
 
   using _prepared_statement_t = prepared_statement_t;
+  using _context_t = context_t;
 
  private:
   friend class sqlpp::statement_handler_t;
@@ -135,7 +137,7 @@ class connection_base : public sqlpp::connection {
   text_result_t run_prepared_select_impl(prepared_statement_t& prep) {
     validate_connection_handle();
     return {detail::execute_prepared_statement(_handle, prep),
-            _handle.config.get()};
+            prep._result_var_buffers, _handle.config.get()};
   }
 
   command_result run_prepared_execute_impl(prepared_statement_t& prep) {
@@ -294,6 +296,23 @@ class connection_base : public sqlpp::connection {
     return sqlpp::statement_handler_t{}.prepare(t, *this);
   }
 
+  //! fetch_one returns the first row of a select, if any, with fields that own
+  //! their data. With a Row type, the row is read into that aggregate instead,
+  //! see core/query/fetch.h.
+  template <typename Row = void, typename T>
+    requires(sqlpp::no_of_result_columns<std::decay_t<T>>::value > 0)
+  auto fetch_one(T&& t) {
+    return sqlpp::detail::fetch_one<Row>(*this, std::forward<T>(t));
+  }
+
+  //! fetch_value returns the value of the single column of the first row of a
+  //! select, if any.
+  template <typename T>
+    requires(sqlpp::no_of_result_columns<std::decay_t<T>>::value == 1)
+  auto fetch_value(T&& t) {
+    return sqlpp::detail::fetch_value(*this, std::forward<T>(t));
+  }
+
   //! set the default transaction isolation level to use for new transactions
   void set_default_isolation_level(isolation_level level) {
     std::string level_str = "read uncommmitted";
@@ -29,6 +29,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include <sqlpp23/core/debug_logger.h>
 
@@ -42,6 +43,24 @@ struct connection_config {
     verify_ca,
     verify_full
   };
+  // See libpq's target_session_attrs. All but any and read_write require
+  // libpq 14 or later.
+  enum class target_session_attrs_t {
+    any,
+    read_write,
+    read_only,
+    primary,
+    standby,
+    prefer_standby
+  };
+  // See libpq's load_balance_hosts, requires libpq 16 or later.
+  enum class load_balance_hosts_t { disable, random };
+  struct endpoint {
+    std::string host;
+    uint32_t port{5432};
+
+    bool operator==(const endpoint&) const = default;
+  };
   std::string host;
   std::string hostaddr;
   uint32_t port{5432};
@@ -66,6 +85,10 @@ struct connection_config {
   std::string requirepeer;
   std::string krbsrvname;
   std::string service;
+  // Hosts to try instead of host and port, e.g. a primary and its standbys.
+  std::vector<endpoint> endpoints;
+  target_session_attrs_t target_session_attrs{target_session_attrs_t::any};
+  load_balance_hosts_t load_balance_hosts{load_balance_hosts_t::disable};
   // bool auto_reconnect {true};
   debug_logger debug; // not compared
 
@@ -85,7 +108,9 @@ struct connection_config {
         other.sslcert == sslcert && other.sslkey == sslkey &&
         other.sslrootcert == sslrootcert && other.sslcrl == sslcrl &&
         other.requirepeer == requirepeer && other.krbsrvname == krbsrvname &&
-        other.service == service);
+        other.service == service && other.endpoints == endpoints &&
+        other.target_session_attrs == target_session_attrs &&
+        other.load_balance_hosts == load_balance_hosts);
   }
   bool operator!=(const connection_config& other) { return !operator==(other); }
 };
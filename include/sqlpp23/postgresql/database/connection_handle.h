@@ -27,8 +27,21 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <future>
 #include <memory>
 #include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <poll.h>
+#endif
 
 #include <libpq-fe.h>
 
@@ -36,6 +49,182 @@
 #include <sqlpp23/postgresql/database/exception.h>
 
 namespace sqlpp::postgresql::detail {
+inline std::string make_conninfo(const connection_config& config) {
+  auto conninfo = std::string{};
+  if (not config.endpoints.empty()) {
+    auto hosts = std::string{};
+    auto ports = std::string{};
+    for (const auto& endpoint : config.endpoints) {
+      hosts.append((hosts.empty() ? "" : ",") + endpoint.host);
+      ports.append((ports.empty() ? "" : ",") + std::to_string(endpoint.port));
+    }
+    conninfo.append("host=" + hosts + " port=" + ports);
+  } else {
+    if (!config.host.empty()) {
+      conninfo.append("host=" + config.host);
+    }
+    if (!config.hostaddr.empty()) {
+      conninfo.append(" hostaddr=" + config.hostaddr);
+    }
+    if (config.port != 5432) {
+      conninfo.append(" port=" + std::to_string(config.port));
+    }
+  }
+  if (!config.dbname.empty()) {
+    conninfo.append(" dbname=" + config.dbname);
+  }
+  if (!config.user.empty()) {
+    conninfo.append(" user=" + config.user);
+  }
+  if (!config.password.empty()) {
+    conninfo.append(" password=" + config.password);
+  }
+  if (config.connect_timeout != 0) {
+    conninfo.append(" connect_timeout=" +
+                    std::to_string(config.connect_timeout));
+  }
+  if (!config.client_encoding.empty()) {
+    conninfo.append(" client_encoding=" + config.client_encoding);
+  }
+  if (!config.options.empty()) {
+    conninfo.append(" options=" + config.options);
+  }
+  if (!config.application_name.empty()) {
+    conninfo.append(" application_name=" + config.application_name);
+  }
+  if (!config.fallback_application_name.empty()) {
+    conninfo.append(" fallback_application_name=" +
+                    config.fallback_application_name);
+  }
+  if (!config.keepalives) {
+    conninfo.append(" keepalives=0");
+  }
+  if (config.keepalives_idle != 0) {
+    conninfo.append(" keepalives_idle=" +
+                    std::to_string(config.keepalives_idle));
+  }
+  if (config.keepalives_interval != 0) {
+    conninfo.append(" keepalives_interval=" +
+                    std::to_string(config.keepalives_interval));
+  }
+  if (config.keepalives_count != 0) {
+    conninfo.append(" keepalives_count=" +
+                    std::to_string(config.keepalives_count));
+  }
+  switch (config.sslmode) {
+    case connection_config::sslmode_t::disable:
+      conninfo.append(" sslmode=disable");
+      break;
+    case connection_config::sslmode_t::allow:
+      conninfo.append(" sslmode=allow");
+      break;
+    case connection_config::sslmode_t::require:
+      conninfo.append(" sslmode=require");
+      break;
+    case connection_config::sslmode_t::verify_ca:
+      conninfo.append(" sslmode=verify-ca");
+      break;
+    case connection_config::sslmode_t::verify_full:
+      conninfo.append(" sslmode=verify-full");
+      break;
+    case connection_config::sslmode_t::prefer:
+      break;
+  }
+  if (!config.sslcompression) {
+    conninfo.append(" sslcompression=0");
+  }
+  if (!config.sslcert.empty()) {
+    conninfo.append(" sslcert=" + config.sslcert);
+  }
+  if (!config.sslkey.empty()) {
+    conninfo.append(" sslkey=" + config.sslkey);
+  }
+  if (!config.sslrootcert.empty()) {
+    conninfo.append(" sslrootcert=" + config.sslrootcert);
+  }
+  if (!config.requirepeer.empty()) {
+    conninfo.append(" requirepeer=" + config.requirepeer);
+  }
+  if (!config.krbsrvname.empty()) {
+    conninfo.append(" krbsrvname=" + config.krbsrvname);
+  }
+  if (!config.service.empty()) {
+    conninfo.append(" service=" + config.service);
+  }
+  switch (config.target_session_attrs) {
+    case connection_config::target_session_attrs_t::any:
+      break;
+    case connection_config::target_session_attrs_t::read_write:
+      conninfo.append(" target_session_attrs=read-write");
+      break;
+    case connection_config::target_session_attrs_t::read_only:
+      conninfo.append(" target_session_attrs=read-only");
+      break;
+    case connection_config::target_session_attrs_t::primary:
+      conninfo.append(" target_session_attrs=primary");
+      break;
+    case connection_config::target_session_attrs_t::standby:
+      conninfo.append(" target_session_attrs=standby");
+      break;
+    case connection_config::target_session_attrs_t::prefer_standby:
+      conninfo.append(" target_session_attrs=prefer-standby");
+      break;
+  }
+  if (config.load_balance_hosts ==
+      connection_config::load_balance_hosts_t::random) {
+    conninfo.append(" load_balance_hosts=random");
+  }
+  return conninfo;
+}
+
+// Whether a server reporting the given in_hot_standby and
+// default_transaction_read_only parameters satisfies target_session_attrs,
+// using libpq's rules: read_write requires both to be off, read_only accepts
+// either being on (e.g. a primary with default_transaction_read_only=on).
+// Servers before PostgreSQL 14 do not report these, nullptr is always accepted.
+inline bool matches_target_session_attrs(
+    connection_config::target_session_attrs_t target,
+    const char* in_hot_standby,
+    const char* default_transaction_read_only) {
+  if (in_hot_standby == nullptr) {
+    return true;
+  }
+  const bool standby = std::strcmp(in_hot_standby, "on") == 0;
+  const auto read_only = [&] {
+    return standby or (default_transaction_read_only != nullptr and
+                       std::strcmp(default_transaction_read_only, "on") == 0);
+  };
+  switch (target) {
+    case connection_config::target_session_attrs_t::read_write:
+      return not read_only();
+    case connection_config::target_session_attrs_t::read_only:
+      return default_transaction_read_only == nullptr or read_only();
+    case connection_config::target_session_attrs_t::primary:
+      return not standby;
+    case connection_config::target_session_attrs_t::standby:
+      return standby;
+    default:
+      return true;
+  }
+}
+
+// Whether the server still satisfies the configured target_session_attrs,
+// e.g. after a standby was promoted. Does not send anything to the server.
+inline bool matches_target_session_attrs(const connection_config& config,
+                                         PGconn* conn) {
+  return matches_target_session_attrs(
+      config.target_session_attrs, PQparameterStatus(conn, "in_hot_standby"),
+      PQparameterStatus(conn, "default_transaction_read_only"));
+}
+
+inline int poll_sockets(std::vector<pollfd>& fds, int timeout_ms) {
+#ifdef _WIN32
+  return WSAPoll(fds.data(), static_cast<ULONG>(fds.size()), timeout_ms);
+#else
+  return ::poll(fds.data(), static_cast<nfds_t>(fds.size()), timeout_ms);
+#endif
+}
+
 struct connection_handle {
   std::shared_ptr<const connection_config> config;
   std::unique_ptr<PGconn, void (*)(PGconn*)> postgres;
@@ -50,104 +239,109 @@ struct connection_handle {
                         "connecting to the database server.");
     }
 
-    // Open connection
-    std::string conninfo = "";
-    if (!config->host.empty()) {
-      conninfo.append("host=" + config->host);
-    }
-    if (!config->hostaddr.empty()) {
-      conninfo.append(" hostaddr=" + config->hostaddr);
-    }
-    if (config->port != 5432) {
-      conninfo.append(" port=" + std::to_string(config->port));
-    }
-    if (!config->dbname.empty()) {
-      conninfo.append(" dbname=" + config->dbname);
-    }
-    if (!config->user.empty()) {
-      conninfo.append(" user=" + config->user);
-    }
-    if (!config->password.empty()) {
-      conninfo.append(" password=" + config->password);
-    }
-    if (config->connect_timeout != 0) {
-      conninfo.append(" connect_timeout=" +
-                      std::to_string(config->connect_timeout));
-    }
-    if (!config->client_encoding.empty()) {
-      conninfo.append(" client_encoding=" + config->client_encoding);
-    }
-    if (!config->options.empty()) {
-      conninfo.append(" options=" + config->options);
-    }
-    if (!config->application_name.empty()) {
-      conninfo.append(" application_name=" + config->application_name);
-    }
-    if (!config->fallback_application_name.empty()) {
-      conninfo.append(" fallback_application_name=" +
-                      config->fallback_application_name);
-    }
-    if (!config->keepalives) {
-      conninfo.append(" keepalives=0");
-    }
-    if (config->keepalives_idle != 0) {
-      conninfo.append(" keepalives_idle=" +
-                      std::to_string(config->keepalives_idle));
+    postgres.reset(PQconnectdb(make_conninfo(*config).c_str()));
+
+    if (is_connected() == false) {
+      throw connection_exception{PQerrorMessage(native_handle())};
     }
-    if (config->keepalives_interval != 0) {
-      conninfo.append(" keepalives_interval=" +
-                      std::to_string(config->keepalives_interval));
+  }
+
+  // Opens `count` connections concurrently from the calling thread, using
+  // libpq's non-blocking connection functions. The returned futures are ready.
+  static std::vector<std::future<connection_handle>> connect_many(
+      const std::shared_ptr<const connection_config>& config,
+      std::size_t count) {
+    if constexpr (debug_enabled) {
+      config->debug.log(log_category::connection,
+                        "opening {} connections to the database server.",
+                        count);
     }
-    if (config->keepalives_count != 0) {
-      conninfo.append(" keepalives_count=" +
-                      std::to_string(config->keepalives_count));
+
+    struct attempt {
+      std::unique_ptr<PGconn, void (*)(PGconn*)> postgres;
+      PostgresPollingStatusType status;
+      std::promise<connection_handle> promise;
+    };
+    const auto fail = [](attempt& a, const char* message) {
+      a.promise.set_exception(std::make_exception_ptr(connection_exception{
+          a.postgres ? PQerrorMessage(a.postgres.get()) : message}));
+      a.postgres.reset();
+      a.status = PGRES_POLLING_FAILED;
+    };
+
+    const auto conninfo = make_conninfo(*config);
+    // Not resized below, `polled` points into it.
+    auto attempts = std::vector<attempt>{};
+    attempts.reserve(count);
+    auto futures = std::vector<std::future<connection_handle>>{};
+    for (std::size_t i = 0; i < count; ++i) {
+      // As documented for PQconnectPoll, start as if it returned WRITING.
+      auto& a = attempts.emplace_back(
+          std::unique_ptr<PGconn, void (*)(PGconn*)>{
+              PQconnectStart(conninfo.c_str()), PQfinish},
+          PGRES_POLLING_WRITING, std::promise<connection_handle>{});
+      futures.push_back(a.promise.get_future());
+      if (not a.postgres or PQstatus(a.postgres.get()) == CONNECTION_BAD) {
+        fail(a, "could not allocate connection");
+      }
     }
-    switch (config->sslmode) {
-      case connection_config::sslmode_t::disable:
-        conninfo.append(" sslmode=disable");
-        break;
-      case connection_config::sslmode_t::allow:
-        conninfo.append(" sslmode=allow");
-        break;
-      case connection_config::sslmode_t::require:
-        conninfo.append(" sslmode=require");
-        break;
-      case connection_config::sslmode_t::verify_ca:
-        conninfo.append(" sslmode=verify-ca");
-        break;
-      case connection_config::sslmode_t::verify_full:
-        conninfo.append(" sslmode=verify-full");
-        break;
-      case connection_config::sslmode_t::prefer:
+
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::seconds{config->connect_timeout};
+    auto fds = std::vector<pollfd>{};
+    auto polled = std::vector<attempt*>{};
+    for (;;) {
+      fds.clear();
+      polled.clear();
+      for (auto& a : attempts) {
+        if (a.status == PGRES_POLLING_READING or
+            a.status == PGRES_POLLING_WRITING) {
+          auto fd = pollfd{};
+          fd.fd = static_cast<decltype(fd.fd)>(PQsocket(a.postgres.get()));
+          fd.events = a.status == PGRES_POLLING_READING ? POLLIN : POLLOUT;
+          fds.push_back(fd);
+          polled.push_back(&a);
+        }
+      }
+      if (fds.empty()) {
         break;
-    }
-    if (!config->sslcompression) {
-      conninfo.append(" sslcompression=0");
-    }
-    if (!config->sslcert.empty()) {
-      conninfo.append(" sslcert=" + config->sslcert);
-    }
-    if (!config->sslkey.empty()) {
-      conninfo.append(" sslkey=" + config->sslkey);
-    }
-    if (!config->sslrootcert.empty()) {
-      conninfo.append(" sslrootcert=" + config->sslrootcert);
-    }
-    if (!config->requirepeer.empty()) {
-      conninfo.append(" requirepeer=" + config->requirepeer);
-    }
-    if (!config->krbsrvname.empty()) {
-      conninfo.append(" krbsrvname=" + config->krbsrvname);
-    }
-    if (!config->service.empty()) {
-      conninfo.append(" service=" + config->service);
-    }
+      }
 
-    postgres.reset(PQconnectdb(conninfo.c_str()));
+      auto timeout_ms = -1;
+      if (config->connect_timeout != 0) {
+        timeout_ms = static_cast<int>(std::max<std::int64_t>(
+            0, std::chrono::duration_cast<std::chrono::milliseconds>(
+                   deadline - std::chrono::steady_clock::now())
+                   .count()));
+      }
+      const auto ready = poll_sockets(fds, timeout_ms);
+      if (ready < 0 and errno == EINTR) {
+        continue;
+      }
+      if (ready <= 0) {
+        for (auto* a : polled) {
+          a->postgres.reset();
+          fail(*a, ready == 0 ? "timeout while connecting to the server"
+                              : "could not wait for the server");
+        }
+        break;
+      }
 
-    if (is_connected() == false) {
-      throw connection_exception{PQerrorMessage(native_handle())};
+      for (std::size_t i = 0; i < fds.size(); ++i) {
+        if (fds[i].revents == 0) {
+          continue;
+        }
+        auto& a = *polled[i];
+        a.status = PQconnectPoll(a.postgres.get());
+        if (a.status == PGRES_POLLING_OK) {
+          a.promise.set_value(
+              connection_handle{config, std::move(a.postgres)});
+        } else if (a.status == PGRES_POLLING_FAILED) {
+          fail(a, "");
+        }
+      }
     }
+    return futures;
   }
 
   connection_handle(const connection_handle&) = delete;
@@ -174,7 +368,8 @@ struct connection_handle {
   PGconn* native_handle() const { return postgres.get(); }
 
   bool is_connected() const {
-    return native_handle() and (PQstatus(native_handle()) == CONNECTION_OK);
+    return native_handle() and (PQstatus(native_handle()) == CONNECTION_OK) and
+           matches_target_session_attrs(*config, native_handle());
   }
 
   bool ping_server() const {
@@ -189,5 +384,11 @@ struct connection_handle {
   }
 
   const debug_logger& debug() { return config->debug; }
+
+ private:
+  // Takes over an established connection.
+  connection_handle(const std::shared_ptr<const connection_config>& conf,
+                    std::unique_ptr<PGconn, void (*)(PGconn*)> conn)
+      : config{conf}, postgres{std::move(conn)} {}
 };
 }  // namespace sqlpp::postgresql::detail
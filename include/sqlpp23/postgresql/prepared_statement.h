@@ -28,7 +28,10 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <libpq-fe.h>
 
@@ -59,6 +62,10 @@ class prepared_statement_t {
   std::vector<bool> _stmt_null_parameters;
   std::vector<std::string> _stmt_parameters;
 
+  // Blob buffers, reused by the results of each execution
+  std::shared_ptr<std::vector<std::vector<uint8_t>>> _result_var_buffers =
+      std::make_shared<std::vector<std::vector<uint8_t>>>();
+
   const connection_config* _config;
 
  public:
@@ -255,6 +262,36 @@ class prepared_statement_t {
     }
   }
 
+  template <typename Element>
+  void _bind_parameter(size_t index, const std::vector<Element>& values) {
+    if constexpr (debug_enabled) {
+      _config->debug.log(log_category::parameter,
+                           "binding array parameter of size {} at index {}",
+                           values.size(), index);
+    }
+
+    // Each element is converted like a scalar parameter and then quoted as an
+    // element of an array literal.
+    auto param = std::string{"{"};
+    for (const auto& value : values) {
+      if (param.size() > 1) {
+        param.push_back(',');
+      }
+      _bind_parameter(index, value);
+      param.push_back('"');
+      for (const char c : _stmt_parameters[index]) {
+        if (c == '"' or c == '\\') {
+          param.push_back('\\');
+        }
+        param.push_back(c);
+      }
+      param.push_back('"');
+    }
+    param.push_back('}');
+    _stmt_null_parameters[index] = false;
+    _stmt_parameters[index] = std::move(param);
+  }
+
   template <typename Parameter>
   void _bind_parameter(size_t index,
                        const std::optional<Parameter>& parameter) {
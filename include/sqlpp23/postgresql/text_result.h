@@ -27,9 +27,12 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <span>
 #include <string_view>
+#include <vector>
 
 #include <libpq-fe.h>
 #include <pg_config.h>
@@ -105,6 +108,9 @@ class text_result_t {
   int _field_count = 0;
   // Need to buffer blobs (or switch to PQexecParams with binary results)
   std::vector<std::vector<uint8_t>> _var_buffers;
+  // Blob buffers of a prepared statement, handed back on destruction, so that
+  // repeated executions stop allocating.
+  std::shared_ptr<std::vector<std::vector<uint8_t>>> _reusable_var_buffers;
 
   bool next_impl() {
     if constexpr (debug_enabled) {
@@ -125,12 +131,23 @@ class text_result_t {
   text_result_t() = default;
 
   text_result_t(pg_result_t pg_result, const connection_config* config)
+      : text_result_t{std::move(pg_result), nullptr, config} {}
+
+  // Takes the blob buffers of a previous execution of the prepared statement,
+  // if they are available.
+  text_result_t(
+      pg_result_t pg_result,
+      std::shared_ptr<std::vector<std::vector<uint8_t>>> reusable_var_buffers,
+      const connection_config* config)
       : _pg_result{std::move(pg_result)},
         _config{config},
         _row_count{PQntuples(_pg_result.get())},
         _field_count{PQnfields(_pg_result.get())},
-        _var_buffers{static_cast<size_t>(_field_count),
-                     std::vector<uint8_t>{}} {
+        _reusable_var_buffers{std::move(reusable_var_buffers)} {
+    if (_reusable_var_buffers) {
+      _var_buffers.swap(*_reusable_var_buffers);
+    }
+    _var_buffers.resize(static_cast<size_t>(_field_count));
     if constexpr (debug_enabled) {
       _config->debug.log(log_category::result,
                          "constructing bind result, using handle at {}",
@@ -153,7 +170,11 @@ class text_result_t {
   text_result_t(text_result_t&&) = default;
   text_result_t& operator=(const text_result_t&) = delete;
   text_result_t& operator=(text_result_t&&) = default;
-  ~text_result_t() = default;
+  ~text_result_t() {
+    if (_reusable_var_buffers) {
+      _reusable_var_buffers->swap(_var_buffers);
+    }
+  }
 
   size_t affected_rows() {
     return std::strtoull(PQcmdTuples(_pg_result.get()), nullptr, 10);
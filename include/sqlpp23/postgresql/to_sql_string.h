@@ -40,6 +40,15 @@ auto to_sql_string(postgresql::context_t& context,
   return std::string("$") + std::to_string(++context._count);
 }
 
+// Array parameters are bound as array literals, e.g. {"1","2","3"}. The type
+// of the array is inferred by the server, e.g. from `id = ANY($1)`.
+template <typename DataType, typename NameType>
+auto to_sql_string(postgresql::context_t& context,
+                   const array_parameter_t<DataType, NameType>&)
+    -> std::string {
+  return std::string("$") + std::to_string(++context._count);
+}
+
 // MySQL and sqlite3 use x'...', but PostgreSQL uses '\x...' to encode
 // hexadecimal literals
 inline auto to_sql_string(postgresql::context_t&,
@@ -152,6 +152,50 @@ struct compatibility_check<sqlite3::context_t, on_conflict_t<Columns...>> {
 }  // namespace sqlpp
 #endif
 
+#if SQLITE_VERSION_NUMBER < 3038000
+namespace sqlpp {
+namespace sqlite3 {
+class assert_no_array_parameter_t : public wrapped_static_assert {
+ public:
+  template <typename... T>
+  static void verify(T&&...) {
+    static_assert(
+        wrong<T...>,
+        "Sqlite3: No support for array parameters before version 3.38.0");
+  }
+};
+}  // namespace sqlite3
+
+template <typename DataType, typename NameTag>
+struct compatibility_check<sqlite3::context_t,
+                           array_parameter_t<DataType, NameTag>> {
+  using type = sqlite3::assert_no_array_parameter_t;
+};
+}  // namespace sqlpp
+#endif
+
+#if SQLITE_VERSION_NUMBER < 3041000
+namespace sqlpp {
+namespace sqlite3 {
+class assert_no_blob_array_parameter_t : public wrapped_static_assert {
+ public:
+  template <typename... T>
+  static void verify(T&&...) {
+    static_assert(wrong<T...>,
+                  "Sqlite3: No support for array parameters of blobs before "
+                  "version 3.41.0");
+  }
+};
+}  // namespace sqlite3
+
+template <typename NameTag>
+struct compatibility_check<sqlite3::context_t,
+                           array_parameter_t<blob, NameTag>> {
+  using type = sqlite3::assert_no_blob_array_parameter_t;
+};
+}  // namespace sqlpp
+#endif
+
 #if SQLITE_VERSION_NUMBER < 3008003
 namespace sqlpp {
 namespace sqlite3 {
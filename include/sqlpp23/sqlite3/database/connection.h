@@ -28,7 +28,11 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
+#include <memory>
+#include <span>
 #include <string>
+#include <vector>
 
 #ifdef SQLPP_USE_SQLCIPHER
 #include <sqlcipher/sqlite3.h>
@@ -38,6 +42,7 @@
 #include <sqlpp23/core/basic/schema.h>
 #include <sqlpp23/core/database/connection.h>
 #include <sqlpp23/core/database/transaction.h>
+#include <sqlpp23/core/query/fetch.h>
 #include <sqlpp23/core/query/statement_handler.h>
 #include <sqlpp23/core/to_sql_string.h>
 #include <sqlpp23/core/type_traits.h>
@@ -47,6 +52,8 @@
 #include <sqlpp23/sqlite3/database/connection_handle.h>
 #include <sqlpp23/sqlite3/database/exception.h>
 #include <sqlpp23/sqlite3/database/serializer_context.h>
+#include <sqlpp23/sqlite3/database/status.h>
+#include <sqlpp23/sqlite3/function/user_defined_function.h>
 #include <sqlpp23/sqlite3/prepared_statement.h>
 #include <sqlpp23/sqlite3/to_sql_string.h>
 
@@ -74,6 +81,38 @@ inline void execute_statement(connection_handle& handle,
       throw exception{sqlite3_errmsg(handle.native_handle()), rc};
   }
 }
+
+// Copies `source_schema` of `source` into `destination_schema` of
+// `destination`, `pages_per_step` pages at a time (all pages if negative).
+inline void backup(::sqlite3* destination,
+                   const std::string& destination_schema,
+                   ::sqlite3* source,
+                   const std::string& source_schema,
+                   int pages_per_step) {
+  auto* backup = sqlite3_backup_init(destination, destination_schema.c_str(),
+                                     source, source_schema.c_str());
+  if (not backup) {
+    throw exception{sqlite3_errmsg(destination), sqlite3_errcode(destination)};
+  }
+
+  auto rc = SQLITE_OK;
+  do {
+    rc = sqlite3_backup_step(backup, pages_per_step);
+    if (rc == SQLITE_BUSY or rc == SQLITE_LOCKED) {
+      // Another connection holds a lock, give it some time to finish.
+      sqlite3_sleep(10);
+    }
+  } while (rc == SQLITE_OK or rc == SQLITE_BUSY or rc == SQLITE_LOCKED);
+
+  // sqlite3_backup_finish releases the backup object in any case.
+  const auto finish_rc = sqlite3_backup_finish(backup);
+  if (rc != SQLITE_DONE) {
+    throw exception{sqlite3_errstr(rc), rc};
+  }
+  if (finish_rc != SQLITE_OK) {
+    throw exception{sqlite3_errmsg(destination), finish_rc};
+  }
+}
 }  // namespace detail
 
 struct command_result {
@@ -94,12 +133,24 @@ class connection_base : public sqlpp::connection {
   using _handle_t = detail::connection_handle;
 
   using _prepared_statement_t = prepared_statement_t;
+  using _context_t = context_t;
 
  private:
   friend sqlpp::statement_handler_t;
 
   bool _transaction_active{false};
 
+  // The configuration of a helper connection to another database file, e.g.
+  // for backups. It uses the key (if any), VFS, and logging of this
+  // connection.
+  std::shared_ptr<connection_config> file_config(const std::string& path,
+                                                 int flags) const {
+    auto config = std::make_shared<connection_config>(*_handle.config);
+    config->path_to_database = path;
+    config->flags = flags;
+    return config;
+  }
+
   // direct execution
   command_result execute_impl(std::string_view statement) {
     auto prepared = prepare_statement(_handle, statement);
@@ -327,6 +378,23 @@ class connection_base : public sqlpp::connection {
     return sqlpp::statement_handler_t{}.prepare(t, *this);
   }
 
+  //! fetch_one returns the first row of a select, if any, with fields that own
+  //! their data. With a Row type, the row is read into that aggregate instead,
+  //! see core/query/fetch.h.
+  template <typename Row = void, typename T>
+    requires(sqlpp::no_of_result_columns<std::decay_t<T>>::value > 0)
+  auto fetch_one(T&& t) {
+    return sqlpp::detail::fetch_one<Row>(*this, std::forward<T>(t));
+  }
+
+  //! fetch_value returns the value of the single column of the first row of a
+  //! select, if any.
+  template <typename T>
+    requires(sqlpp::no_of_result_columns<std::decay_t<T>>::value == 1)
+  auto fetch_value(T&& t) {
+    return sqlpp::detail::fetch_value(*this, std::forward<T>(t));
+  }
+
   //! set the transaction isolation level for this connection
   void set_default_isolation_level(isolation_level level) {
     if (level == sqlpp::isolation_level::read_uncommitted) {
@@ -403,6 +471,153 @@ class connection_base : public sqlpp::connection {
     return {name};
   }
 
+  //! Online backup of the database `schema` into the file at `path`.
+  //! `pages_per_step` pages are copied per step (all pages at once if
+  //! negative). Other connections may access the database between steps.
+  void backup_to(const std::string& path,
+                 int pages_per_step = -1,
+                 const std::string& schema = "main") {
+    if constexpr (debug_enabled) {
+      _handle.debug().log(log_category::connection,
+                          "backing up schema {} to {}", schema, path);
+    }
+    auto target = _handle_t{
+        file_config(path, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE)};
+    detail::backup(target.native_handle(), "main", native_handle(), schema,
+                   pages_per_step);
+  }
+
+  //! Replaces the database `schema` with the contents of the database file at
+  //! `path`, copying `pages_per_step` pages per step (all pages at once if
+  //! negative).
+  void restore_from(const std::string& path,
+                    int pages_per_step = -1,
+                    const std::string& schema = "main") {
+    if constexpr (debug_enabled) {
+      _handle.debug().log(log_category::connection,
+                          "restoring schema {} from {}", schema, path);
+    }
+    auto source = _handle_t{file_config(path, SQLITE_OPEN_READONLY)};
+    detail::backup(native_handle(), schema, source.native_handle(), "main",
+                   pages_per_step);
+  }
+
+#if SQLITE_VERSION_NUMBER >= 3036000
+  //! Returns a copy of the database `schema` as it would be written to disk.
+  std::vector<uint8_t> serialize(const std::string& schema = "main") const {
+    sqlite3_int64 size = 0;
+    const auto data = std::unique_ptr<unsigned char, void (*)(void*)>{
+        sqlite3_serialize(native_handle(), schema.c_str(), &size, 0),
+        sqlite3_free};
+    if (not data) {
+      // A database without any pages serializes to nothing.
+      if (size == 0) {
+        return {};
+      }
+      throw exception{"Sqlite3 connector: Cannot serialize schema " + schema,
+                      SQLITE_NOMEM};
+    }
+    return {data.get(), data.get() + size};
+  }
+
+  //! Replaces the database `schema` with an in-memory database holding a copy
+  //! of `data`, e.g. obtained by `serialize()`.
+  void deserialize(std::span<const uint8_t> data,
+                   const std::string& schema = "main") {
+    const auto size = static_cast<sqlite3_int64>(data.size());
+    auto* buffer =
+        static_cast<unsigned char*>(sqlite3_malloc64(data.size()));
+    if (size > 0 and not buffer) {
+      throw exception{"Sqlite3 connector: Cannot allocate deserialize buffer",
+                      SQLITE_NOMEM};
+    }
+    std::copy(data.begin(), data.end(), buffer);
+
+    // SQLite takes ownership of the buffer, even if deserialization fails.
+    const auto rc = sqlite3_deserialize(
+        native_handle(), schema.c_str(), buffer, size, size,
+        SQLITE_DESERIALIZE_FREEONCLOSE | SQLITE_DESERIALIZE_RESIZEABLE);
+    if (rc != SQLITE_OK) {
+      throw exception{sqlite3_errmsg(native_handle()), rc};
+    }
+  }
+#endif
+
+  //! Counters of this connection, optionally resetting them.
+  database_status status(bool reset = false) {
+    return detail::get_database_status(native_handle(), reset);
+  }
+
+  //! Counters of a statement prepared by this connection.
+  template <typename PreparedStatement>
+    requires(sqlpp::is_prepared_statement_v<PreparedStatement>)
+  statement_status status(PreparedStatement& statement, bool reset = false) {
+    return sqlpp::statement_handler_t{}
+        .get_prepared_statement(statement)
+        .status(reset);
+  }
+
+  //! Counters of all statements of this connection that are currently
+  //! prepared, including those held by unfinished results.
+  std::vector<statement_status> statement_statuses(bool reset = false) {
+    auto result = std::vector<statement_status>{};
+    for (auto* statement = sqlite3_next_stmt(native_handle(), nullptr);
+         statement; statement = sqlite3_next_stmt(native_handle(), statement)) {
+      result.push_back(detail::get_statement_status(statement, reset));
+    }
+    return result;
+  }
+
+  //! Registers `callable` as scalar SQL function `name`. Arguments and results
+  //! can be of the types used for parameters and result fields. NULL arguments
+  //! yield NULL unless the respective argument is std::optional. Returns a
+  //! function object to use in statements, e.g.
+  //!   auto twice = db.register_function("twice", [](int64_t x) { return 2 * x; });
+  //!   db(select(tab.id).from(tab).where(twice(tab.id) > 7));
+  template <typename Callable>
+  auto register_function(const std::string& name,
+                         Callable callable,
+                         bool deterministic = false)
+      -> scalar_function_t<detail::callable_signature_t<Callable>> {
+    using _signature_t = detail::callable_signature_t<Callable>;
+    if constexpr (debug_enabled) {
+      _handle.debug().log(log_category::connection,
+                          "registering scalar function {}", name);
+    }
+    // SQLite destroys the callable, even if registration fails.
+    const auto rc = sqlite3_create_function_v2(
+        native_handle(), name.c_str(), detail::signature_arity<_signature_t>(),
+        SQLITE_UTF8 | (deterministic ? SQLITE_DETERMINISTIC : 0),
+        new Callable(std::move(callable)), &detail::call_scalar<Callable>,
+        nullptr, nullptr, &detail::destroy<Callable>);
+    if (rc != SQLITE_OK) {
+      throw exception{sqlite3_errmsg(native_handle()), rc};
+    }
+    return scalar_function_t<_signature_t>{name};
+  }
+
+  //! Registers an aggregate SQL function `name`. Each group works on a copy of
+  //! `aggregate`, calling `step(...)` for each row and `result()` at the end.
+  template <typename Aggregate>
+  auto register_aggregate(const std::string& name, Aggregate aggregate)
+      -> aggregate_function_t<detail::aggregate_signature_t<Aggregate>> {
+    using _signature_t = detail::aggregate_signature_t<Aggregate>;
+    if constexpr (debug_enabled) {
+      _handle.debug().log(log_category::connection,
+                          "registering aggregate function {}", name);
+    }
+    // SQLite destroys the aggregate, even if registration fails.
+    const auto rc = sqlite3_create_function_v2(
+        native_handle(), name.c_str(), detail::signature_arity<_signature_t>(),
+        SQLITE_UTF8, new Aggregate(std::move(aggregate)), nullptr,
+        &detail::step_aggregate<Aggregate>, &detail::final_aggregate<Aggregate>,
+        &detail::destroy<Aggregate>);
+    if (rc != SQLITE_OK) {
+      throw exception{sqlite3_errmsg(native_handle()), rc};
+    }
+    return aggregate_function_t<_signature_t>{name};
+  }
+
   std::string escape(const std::string_view& s) const {
     auto result = std::string{};
     result.reserve(s.size() * 2);
@@ -71,7 +71,7 @@ struct connection_handle {
       int ret = sqlite3_key(native_handle(), conf->password.data(),
                             conf->password.size());
       if (ret != SQLITE_OK) {
-        throw exception{sqlite3_errmsg(native_handle()), rc};
+        throw exception{sqlite3_errmsg(native_handle()), ret};
       }
     }
 #endif
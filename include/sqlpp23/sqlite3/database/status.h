@@ -0,0 +1,109 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdint>
+#include <string>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+#include <sqlpp23/sqlite3/database/exception.h>
+
+namespace sqlpp::sqlite3 {
+// Counters of a prepared statement, see
+// https://www.sqlite.org/c3ref/c_stmtstatus_counter.html
+struct statement_status {
+  std::string sql;
+  int64_t fullscan_steps = 0;
+  int64_t sorts = 0;
+  int64_t autoindexes = 0;
+  int64_t vm_steps = 0;
+  int64_t reprepares = 0;
+  int64_t runs = 0;
+  int64_t memory_used = 0;  // Not affected by reset.
+};
+
+// Counters of a database connection, see
+// https://www.sqlite.org/c3ref/c_dbstatus_options.html
+struct database_status {
+  int64_t lookaside_used = 0;
+  int64_t cache_used = 0;
+  int64_t cache_hits = 0;
+  int64_t cache_misses = 0;
+  int64_t cache_writes = 0;
+  int64_t schema_used = 0;
+  int64_t statements_used = 0;
+};
+
+namespace detail {
+inline auto get_statement_status(sqlite3_stmt* statement, bool reset)
+    -> statement_status {
+  const auto counter = [&](int op) -> int64_t {
+    return sqlite3_stmt_status(statement, op, reset ? 1 : 0);
+  };
+
+  const char* sql = sqlite3_sql(statement);
+  return {
+      .sql = sql ? sql : "",
+      .fullscan_steps = counter(SQLITE_STMTSTATUS_FULLSCAN_STEP),
+      .sorts = counter(SQLITE_STMTSTATUS_SORT),
+      .autoindexes = counter(SQLITE_STMTSTATUS_AUTOINDEX),
+      .vm_steps = counter(SQLITE_STMTSTATUS_VM_STEP),
+      .reprepares = counter(SQLITE_STMTSTATUS_REPREPARE),
+      .runs = counter(SQLITE_STMTSTATUS_RUN),
+      .memory_used = counter(SQLITE_STMTSTATUS_MEMUSED),
+  };
+}
+
+inline auto get_database_status(::sqlite3* db, bool reset)
+    -> database_status {
+  const auto current = [&](int op) -> int64_t {
+    int value = 0;
+    int highwater = 0;
+    const auto rc = sqlite3_db_status(db, op, &value, &highwater, reset ? 1 : 0);
+    if (rc != SQLITE_OK) {
+      throw exception{sqlite3_errstr(rc), rc};
+    }
+    return value;
+  };
+
+  return {
+      .lookaside_used = current(SQLITE_DBSTATUS_LOOKASIDE_USED),
+      .cache_used = current(SQLITE_DBSTATUS_CACHE_USED),
+      .cache_hits = current(SQLITE_DBSTATUS_CACHE_HIT),
+      .cache_misses = current(SQLITE_DBSTATUS_CACHE_MISS),
+      .cache_writes = current(SQLITE_DBSTATUS_CACHE_WRITE),
+      .schema_used = current(SQLITE_DBSTATUS_SCHEMA_USED),
+      .statements_used = current(SQLITE_DBSTATUS_STMT_USED),
+  };
+}
+}  // namespace detail
+}  // namespace sqlpp::sqlite3
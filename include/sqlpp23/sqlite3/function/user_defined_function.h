@@ -0,0 +1,517 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cmath>
+#include <concepts>
+#include <cstdlib>
+#include <exception>
+#include <format>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+#include <sqlpp23/core/chrono.h>
+#include <sqlpp23/core/detail/parse_date_time.h>
+#include <sqlpp23/core/logic.h>
+#include <sqlpp23/core/operator/enable_as.h>
+#include <sqlpp23/core/operator/enable_comparison.h>
+#include <sqlpp23/core/reader.h>
+#include <sqlpp23/core/tuple_to_sql_string.h>
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp::sqlite3 {
+namespace detail {
+// Maps argument and result types of user-defined functions to types with a
+// sqlpp data type.
+template <typename T>
+struct function_value {
+  using type = T;
+};
+
+template <>
+struct function_value<std::span<const uint8_t>> {
+  using type = std::vector<uint8_t>;
+};
+
+template <typename T>
+struct function_value<std::optional<T>> {
+  using type = std::optional<typename function_value<T>::type>;
+};
+
+template <typename T>
+using function_value_t = typename function_value<std::remove_cvref_t<T>>::type;
+
+// Signature of a callable, e.g. a lambda.
+template <typename Result, typename... Args>
+struct function_signature {
+  using type = Result(std::remove_cvref_t<Args>...);
+};
+
+template <typename Callable>
+struct callable_signature
+    : public callable_signature<decltype(&Callable::operator())> {};
+
+template <typename Result, typename... Args>
+struct callable_signature<Result (*)(Args...)>
+    : public function_signature<Result, Args...> {};
+
+template <typename Result, typename... Args>
+struct callable_signature<Result (*)(Args...) noexcept>
+    : public function_signature<Result, Args...> {};
+
+template <typename Class, typename Result, typename... Args>
+struct callable_signature<Result (Class::*)(Args...)>
+    : public function_signature<Result, Args...> {};
+
+template <typename Class, typename Result, typename... Args>
+struct callable_signature<Result (Class::*)(Args...) noexcept>
+    : public function_signature<Result, Args...> {};
+
+template <typename Class, typename Result, typename... Args>
+struct callable_signature<Result (Class::*)(Args...) const>
+    : public function_signature<Result, Args...> {};
+
+template <typename Class, typename Result, typename... Args>
+struct callable_signature<Result (Class::*)(Args...) const noexcept>
+    : public function_signature<Result, Args...> {};
+
+template <typename Callable>
+using callable_signature_t = typename callable_signature<Callable>::type;
+
+template <typename Signature>
+struct signature_arity;
+
+template <typename Result, typename... Args>
+struct signature_arity<Result(Args...)>
+    : public std::integral_constant<int, sizeof...(Args)> {};
+
+// Aggregates provide `step(Args...)` and `Result result()`.
+template <typename Result, typename StepSignature>
+struct aggregate_signature;
+
+template <typename Result, typename StepResult, typename... Args>
+struct aggregate_signature<Result, StepResult(Args...)> {
+  using type = Result(Args...);
+};
+
+template <typename Aggregate>
+using aggregate_signature_t = typename aggregate_signature<
+    std::remove_cvref_t<decltype(std::declval<Aggregate&>().result())>,
+    callable_signature_t<decltype(&Aggregate::step)>>::type;
+
+// Reading arguments, see also bind_result_t::read_field.
+inline void read_argument(::sqlite3_value* argument, bool& value) {
+  value = sqlite3_value_int(argument) != 0;
+}
+
+inline void read_argument(::sqlite3_value* argument, int64_t& value) {
+  value = sqlite3_value_int64(argument);
+}
+
+inline void read_argument(::sqlite3_value* argument, uint64_t& value) {
+  value = static_cast<uint64_t>(sqlite3_value_int64(argument));
+}
+
+inline void read_argument(::sqlite3_value* argument, double& value) {
+  switch (sqlite3_value_type(argument)) {
+    case SQLITE3_TEXT:
+      value = std::atof(
+          reinterpret_cast<const char*>(sqlite3_value_text(argument)));
+      break;
+    default:
+      value = sqlite3_value_double(argument);
+  }
+}
+
+inline void read_argument(::sqlite3_value* argument, std::string_view& value) {
+  const auto* text =
+      reinterpret_cast<const char*>(sqlite3_value_text(argument));
+  value = std::string_view(
+      text, static_cast<size_t>(sqlite3_value_bytes(argument)));
+}
+
+inline void read_argument(::sqlite3_value* argument, std::string& value) {
+  auto view = std::string_view{};
+  read_argument(argument, view);
+  value = view;
+}
+
+inline void read_argument(::sqlite3_value* argument,
+                          std::span<const uint8_t>& value) {
+  const auto* blob = static_cast<const uint8_t*>(sqlite3_value_blob(argument));
+  value = std::span<const uint8_t>(
+      blob, static_cast<size_t>(sqlite3_value_bytes(argument)));
+}
+
+inline void read_argument(::sqlite3_value* argument,
+                          std::vector<uint8_t>& value) {
+  auto span = std::span<const uint8_t>{};
+  read_argument(argument, span);
+  value.assign(span.begin(), span.end());
+}
+
+inline void read_argument(::sqlite3_value* argument,
+                          std::chrono::microseconds& value) {
+  const auto* text =
+      reinterpret_cast<const char*>(sqlite3_value_text(argument));
+  if (::sqlpp::detail::parse_time(value, text) == false) {
+    value = {};
+  }
+}
+
+inline void read_argument(::sqlite3_value* argument,
+                          std::chrono::sys_days& value) {
+  const auto* text =
+      reinterpret_cast<const char*>(sqlite3_value_text(argument));
+  if (::sqlpp::detail::parse_date(value, text) == false) {
+    value = {};
+  }
+}
+
+inline void read_argument(::sqlite3_value* argument,
+                          ::sqlpp::chrono::sys_microseconds& value) {
+  const auto* text =
+      reinterpret_cast<const char*>(sqlite3_value_text(argument));
+  if (::sqlpp::detail::parse_timestamp(value, text) == false) {
+    value = {};
+  }
+}
+
+template <typename T>
+void read_argument(::sqlite3_value* argument, std::optional<T>& value) {
+  if (sqlite3_value_type(argument) == SQLITE_NULL) {
+    value.reset();
+    return;
+  }
+  read_argument(argument, value.emplace());
+}
+
+// Returns false if NULL is passed for an argument that is not optional.
+template <typename... Args, size_t... Is>
+bool read_arguments(std::tuple<Args...>& args,
+                    ::sqlite3_value** arguments,
+                    std::index_sequence<Is...>) {
+  const auto read = [](::sqlite3_value* argument, auto& value) {
+    if constexpr (not is_optional<std::remove_cvref_t<decltype(value)>>::value) {
+      if (sqlite3_value_type(argument) == SQLITE_NULL) {
+        return false;
+      }
+    }
+    read_argument(argument, value);
+    return true;
+  };
+  return (read(arguments[Is], std::get<Is>(args)) and ...);
+}
+
+// Setting results, see also prepared_statement_t::_bind_parameter.
+inline void set_result(::sqlite3_context* context, bool value) {
+  sqlite3_result_int(context, value);
+}
+
+template <std::integral T>
+void set_result(::sqlite3_context* context, T value) {
+  sqlite3_result_int64(context, static_cast<sqlite3_int64>(value));
+}
+
+inline void set_result(::sqlite3_context* context, double value) {
+  if (std::isnan(value)) {
+    sqlite3_result_text(context, "NaN", 3, SQLITE_STATIC);
+  } else if (std::isinf(value)) {
+    if (value > 0) {
+      sqlite3_result_text(context, "Inf", 3, SQLITE_STATIC);
+    } else {
+      sqlite3_result_text(context, "-Inf", 4, SQLITE_STATIC);
+    }
+  } else {
+    sqlite3_result_double(context, value);
+  }
+}
+
+inline void set_result(::sqlite3_context* context, std::string_view value) {
+  sqlite3_result_text64(context, value.data(), value.size(), SQLITE_TRANSIENT,
+                        SQLITE_UTF8);
+}
+
+inline void set_result(::sqlite3_context* context,
+                       std::span<const uint8_t> value) {
+  sqlite3_result_blob64(context, value.data(), value.size(), SQLITE_TRANSIENT);
+}
+
+inline void set_result(::sqlite3_context* context,
+                       const std::chrono::microseconds& value) {
+  set_result(context, std::format("{0:%H:%M:%S}", value));
+}
+
+inline void set_result(::sqlite3_context* context,
+                       const std::chrono::sys_days& value) {
+  set_result(context, std::format("{0:%Y-%m-%d}", value));
+}
+
+inline void set_result(::sqlite3_context* context,
+                       const ::sqlpp::chrono::sys_microseconds& value) {
+  set_result(context, std::format("{0:%Y-%m-%d %H:%M:%S}", value));
+}
+
+template <typename T>
+void set_result(::sqlite3_context* context, const std::optional<T>& value) {
+  if (not value) {
+    sqlite3_result_null(context);
+    return;
+  }
+  set_result(context, *value);
+}
+
+template <typename Signature>
+struct function_caller;
+
+template <typename Result, typename... Args>
+struct function_caller<Result(Args...)> {
+  template <typename Callable>
+  static void call(::sqlite3_context* context,
+                   Callable& callable,
+                   ::sqlite3_value** arguments) {
+    auto args = std::tuple<Args...>{};
+    if (not read_arguments(args, arguments, std::index_sequence_for<Args...>{})) {
+      sqlite3_result_null(context);
+      return;
+    }
+    if constexpr (std::is_void_v<Result>) {
+      std::apply(callable, std::move(args));
+      sqlite3_result_null(context);
+    } else {
+      set_result(context, std::apply(callable, std::move(args)));
+    }
+  }
+};
+
+template <typename Callable>
+void call_scalar(::sqlite3_context* context,
+                 int /*argc*/,
+                 ::sqlite3_value** arguments) {
+  try {
+    auto& callable = *static_cast<Callable*>(sqlite3_user_data(context));
+    function_caller<callable_signature_t<Callable>>::call(context, callable,
+                                                          arguments);
+  } catch (const std::exception& e) {
+    sqlite3_result_error(context, e.what(), -1);
+  } catch (...) {
+    // Exceptions must not propagate through sqlite's C frames.
+    sqlite3_result_error(context, "unknown exception", -1);
+  }
+}
+
+// Each group gets its own copy of the aggregate passed to register_aggregate.
+template <typename Aggregate>
+void step_aggregate(::sqlite3_context* context,
+                    int /*argc*/,
+                    ::sqlite3_value** arguments) {
+  auto** state = static_cast<Aggregate**>(
+      sqlite3_aggregate_context(context, sizeof(Aggregate*)));
+  if (not state) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+  try {
+    if (not *state) {
+      *state = new Aggregate(
+          *static_cast<const Aggregate*>(sqlite3_user_data(context)));
+    }
+    auto step = [state](auto&&... args) {
+      (*state)->step(std::forward<decltype(args)>(args)...);
+    };
+    function_caller<callable_signature_t<decltype(&Aggregate::step)>>::call(
+        context, step, arguments);
+  } catch (const std::exception& e) {
+    sqlite3_result_error(context, e.what(), -1);
+  } catch (...) {
+    sqlite3_result_error(context, "unknown exception", -1);
+  }
+}
+
+template <typename Aggregate>
+void final_aggregate(::sqlite3_context* context) {
+  auto** state =
+      static_cast<Aggregate**>(sqlite3_aggregate_context(context, 0));
+  try {
+    // Groups without rows never had step() called.
+    const auto aggregate = std::unique_ptr<Aggregate>{
+        state and *state
+            ? *state
+            : new Aggregate(
+                  *static_cast<const Aggregate*>(sqlite3_user_data(context)))};
+    set_result(context, aggregate->result());
+  } catch (const std::exception& e) {
+    sqlite3_result_error(context, e.what(), -1);
+  } catch (...) {
+    sqlite3_result_error(context, "unknown exception", -1);
+  }
+}
+
+template <typename T>
+void destroy(void* p) {
+  delete static_cast<T*>(p);
+}
+}  // namespace detail
+
+// The call of a user-defined function, see scalar_function_t and
+// aggregate_function_t.
+template <typename DataType, bool IsAggregate, typename... Args>
+class function_call_t : public enable_as, public enable_comparison {
+ public:
+  function_call_t(std::string name, std::tuple<Args...> args)
+      : _name(std::move(name)), _expressions(std::move(args)) {}
+  function_call_t(const function_call_t&) = default;
+  function_call_t(function_call_t&&) = default;
+  function_call_t& operator=(const function_call_t&) = default;
+  function_call_t& operator=(function_call_t&&) = default;
+  ~function_call_t() = default;
+
+  const std::string& name() const { return _name; }
+
+ private:
+  friend reader_t;
+  std::string _name;
+  std::tuple<Args...> _expressions;
+};
+
+template <typename Context, typename DataType, bool IsAggregate,
+          typename... Args>
+auto to_sql_string(Context& context,
+                   const function_call_t<DataType, IsAggregate, Args...>& t)
+    -> std::string {
+  return t.name() + "(" +
+         tuple_to_sql_string(context, read.expressions(t), tuple_operand{", "}) +
+         ")";
+}
+
+namespace detail {
+// NULL passed for an argument that is not optional yields NULL.
+template <typename Result, typename Params, typename Args>
+struct function_call_data_type;
+
+template <typename Result, typename... Params, typename... Args>
+struct function_call_data_type<Result,
+                               std::tuple<Params...>,
+                               std::tuple<Args...>> {
+  using type = std::conditional_t<
+      logic::any<(is_optional<data_type_of_t<Args>>::value and
+                  not is_optional<Params>::value)...>::value,
+      force_optional_t<data_type_of_t<function_value_t<Result>>>,
+      data_type_of_t<function_value_t<Result>>>;
+};
+
+template <typename Result, typename Params, typename Args>
+using function_call_data_type_t =
+    typename function_call_data_type<Result, Params, Args>::type;
+}  // namespace detail
+
+template <typename Signature>
+class scalar_function_t;
+
+//! A scalar user-defined function, see connection_base::register_function.
+template <typename Result, typename... Params>
+class scalar_function_t<Result(Params...)> {
+ public:
+  explicit scalar_function_t(std::string name) : _name(std::move(name)) {}
+
+  template <typename... Args>
+    requires(sizeof...(Args) == sizeof...(Params) and
+             logic::all<values_are_comparable<
+                 Args,
+                 detail::function_value_t<Params>>::value...>::value)
+  auto operator()(Args... args) const
+      -> function_call_t<detail::function_call_data_type_t<Result,
+                                                           std::tuple<Params...>,
+                                                           std::tuple<Args...>>,
+                         false,
+                         Args...> {
+    return {_name, std::make_tuple(std::move(args)...)};
+  }
+
+  const std::string& name() const { return _name; }
+
+ private:
+  std::string _name;
+};
+
+template <typename Signature>
+class aggregate_function_t;
+
+//! A user-defined aggregate function, see connection_base::register_aggregate.
+template <typename Result, typename... Params>
+class aggregate_function_t<Result(Params...)> {
+ public:
+  explicit aggregate_function_t(std::string name) : _name(std::move(name)) {}
+
+  template <typename... Args>
+    requires(sizeof...(Args) == sizeof...(Params) and
+             logic::all<values_are_comparable<
+                 Args,
+                 detail::function_value_t<Params>>::value...>::value and
+             not logic::any<contains_aggregate_function<Args>::value...>::value)
+  auto operator()(Args... args) const
+      -> function_call_t<data_type_of_t<detail::function_value_t<Result>>,
+                         true,
+                         Args...> {
+    return {_name, std::make_tuple(std::move(args)...)};
+  }
+
+  const std::string& name() const { return _name; }
+
+ private:
+  std::string _name;
+};
+}  // namespace sqlpp::sqlite3
+
+namespace sqlpp {
+template <typename DataType, bool IsAggregate, typename... Args>
+struct data_type_of<sqlite3::function_call_t<DataType, IsAggregate, Args...>> {
+  using type = DataType;
+};
+
+template <typename DataType, bool IsAggregate, typename... Args>
+struct nodes_of<sqlite3::function_call_t<DataType, IsAggregate, Args...>> {
+  using type = detail::type_vector<Args...>;
+};
+
+template <typename DataType, typename... Args>
+struct is_aggregate_function<sqlite3::function_call_t<DataType, true, Args...>>
+    : public std::true_type {};
+}  // namespace sqlpp
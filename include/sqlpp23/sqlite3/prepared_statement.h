@@ -29,7 +29,10 @@
 
 #include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <format>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -42,11 +45,88 @@
 #include <sqlpp23/core/chrono.h>
 #include <sqlpp23/sqlite3/database/exception.h>
 #include <sqlpp23/sqlite3/database/connection_config.h>
+#include <sqlpp23/sqlite3/database/status.h>
 
 namespace sqlpp::sqlite3 {
 // Forward declaration
 class connection_base;
 
+namespace detail {
+// Array parameters are bound as JSON arrays and unpacked via json_each().
+inline void append_json_element(std::string& json, bool value) {
+  json += value ? "1" : "0";
+}
+
+inline void append_json_element(std::string& json, int64_t value) {
+  json += std::to_string(value);
+}
+
+inline void append_json_element(std::string& json, uint64_t value) {
+  // Same as for scalar parameters: sqlite3 stores 64 bit signed integers.
+  json += std::to_string(static_cast<int64_t>(value));
+}
+
+inline void append_json_element(std::string& json, double value) {
+  // JSON has no representation of NaN and infinity. Use the same text values
+  // as for scalar parameters.
+  if (std::isnan(value)) {
+    json += "\"NaN\"";
+  } else if (std::isinf(value)) {
+    json += value > 0 ? "\"Inf\"" : "\"-Inf\"";
+  } else {
+    json += std::format("{}", value);
+  }
+}
+
+inline void append_json_element(std::string& json, std::string_view value) {
+  json += '"';
+  for (const char c : value) {
+    switch (c) {
+      case '"':
+        json += "\\\"";
+        break;
+      case '\\':
+        json += "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          json += std::format("\\u{:04x}", static_cast<unsigned char>(c));
+        } else {
+          json += c;
+        }
+    }
+  }
+  json += '"';
+}
+
+// Blobs are passed as hex strings and converted back via unhex(), see
+// to_sql_string.h.
+inline void append_json_element(std::string& json,
+                                std::span<const uint8_t> value) {
+  json += '"';
+  for (const auto byte : value) {
+    json += std::format("{:02x}", byte);
+  }
+  json += '"';
+}
+
+inline void append_json_element(std::string& json,
+                                const std::chrono::microseconds& value) {
+  append_json_element(json, std::format("{0:%H:%M:%S}", value));
+}
+
+inline void append_json_element(std::string& json,
+                                const std::chrono::sys_days& value) {
+  append_json_element(json, std::format("{0:%Y-%m-%d}", value));
+}
+
+inline void append_json_element(
+    std::string& json,
+    const ::sqlpp::chrono::sys_microseconds& value) {
+  append_json_element(json, std::format("{0:%Y-%m-%d %H:%M:%S}", value));
+}
+}  // namespace detail
+
 class prepared_statement_t {
   friend class ::sqlpp::sqlite3::connection_base;
   ::sqlite3* _connection;
@@ -106,6 +186,11 @@ class prepared_statement_t {
   ::sqlite3_stmt* native_handle() { return _sqlite3_statement.get(); }
   const debug_logger& debug() const { return config->debug; }
 
+  //! Counters of this statement, optionally resetting them.
+  statement_status status(bool reset = false) {
+    return detail::get_statement_status(_sqlite3_statement.get(), reset);
+  }
+
   void _reset() {
     if constexpr (debug_enabled) {
       config->debug.log(log_category::statement,
@@ -272,6 +357,32 @@ class prepared_statement_t {
     }
   }
 
+  template <typename Element>
+  void _bind_parameter(size_t index, const std::vector<Element>& values) {
+    if constexpr (debug_enabled) {
+      config->debug.log(
+          log_category::parameter,
+          "Sqlite3 debug: binding array parameter size of {} at index {}",
+          values.size(), index);
+    }
+
+    std::string json = "[";
+    for (const auto& value : values) {
+      if (json.size() > 1) {
+        json += ',';
+      }
+      detail::append_json_element(json, value);
+    }
+    json += ']';
+
+    const int rc = sqlite3_bind_text(
+        _sqlite3_statement.get(), static_cast<int>(index + 1), json.data(),
+        static_cast<int>(json.size()), SQLITE_TRANSIENT);
+    if (rc != SQLITE_OK) {
+      throw exception{sqlite3_errmsg(_connection), rc};
+    }
+  }
+
   template <typename Parameter>
   void _bind_parameter(size_t index,
                        const std::optional<Parameter>& parameter) {
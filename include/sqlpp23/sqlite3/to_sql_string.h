@@ -80,6 +80,28 @@ auto to_sql_string(context_t& context, const parameter_t<DataType, NameType>&)
   return "?" + std::to_string(++context._count);
 }
 
+// Array parameters are bound as JSON text, see prepared_statement_t.
+template <typename DataType, typename NameType>
+auto to_sql_string(context_t& context,
+                   const array_parameter_t<DataType, NameType>&)
+    -> std::string {
+  return "?" + std::to_string(++context._count);
+}
+
+template <typename L, typename Operator, typename DataType, typename NameType>
+auto to_sql_string(
+    context_t& context,
+    const in_expression<L, Operator, array_parameter_t<DataType, NameType>>& t)
+    -> std::string {
+  // Blob elements are bound as hex strings, see prepared_statement_t.
+  constexpr auto value =
+      std::is_same_v<DataType, blob> ? "unhex(value)" : "value";
+  // Note: Temporary required to enforce parameter ordering.
+  auto ret_val = operand_to_sql_string(context, read.lhs(t)) +
+                 Operator::symbol + " (SELECT " + value + " FROM json_each(";
+  return ret_val + to_sql_string(context, read.rhs(t)) + "))";
+}
+
 // Some special treatment of data types
 template <typename Period>
 auto to_sql_string(
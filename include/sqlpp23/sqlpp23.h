@@ -42,3 +42,4 @@
 #include <sqlpp23/core/function.h>
 #include <sqlpp23/core/name/create_name_tag.h>
 #include <sqlpp23/core/operator.h>
+#include <sqlpp23/core/query/column_batch.h>
@@ -28,7 +28,14 @@
 module;
 
 #include <sqlpp23/sqlpp23.h>
+#include <sqlpp23/core/database/caching_connection.h>
 #include <sqlpp23/core/database/connection_pool.h>
+#include <sqlpp23/core/database/routing_pool.h>
+#include <sqlpp23/core/database/sharded_pool.h>
+#include <sqlpp23/core/query/arrow.h>
+#include <sqlpp23/core/query/chunked_result.h>
+#include <sqlpp23/core/query/fetch.h>
+#include <sqlpp23/core/query/prefetching_result.h>
 #include <sqlpp23/core/detail/parse_date_time.h>
 export module sqlpp23.core;
 
@@ -50,6 +57,8 @@ using ::sqlpp::full_outer_join;
 using ::sqlpp::cross_join;
 using ::sqlpp::parameter;
 using ::sqlpp::parameter_t; // TODO remove?
+using ::sqlpp::array_parameter;
+using ::sqlpp::array_parameter_t;
 using ::sqlpp::verbatim;
 using ::sqlpp::parameterized_verbatim;
 using ::sqlpp::schema;
@@ -222,12 +231,45 @@ using ::sqlpp::isolation_level;
 using ::sqlpp::start_transaction;
 using ::sqlpp::exception;
 using ::sqlpp::connection_check;
+using ::sqlpp::duration_histogram;
+using ::sqlpp::connection_pool_options;
+using ::sqlpp::connection_pool_stats;
+using ::sqlpp::call_site_stats;
+using ::sqlpp::held_connection;
+using ::sqlpp::connection_pool_timeout;
+using ::sqlpp::is_read_only_statement;
+using ::sqlpp::is_read_only_statement_v;
+using ::sqlpp::routing_pool;
+using ::sqlpp::routing_pool_options;
+using ::sqlpp::hash_sharding;
+using ::sqlpp::merged_result;
+using ::sqlpp::range_sharding;
+using ::sqlpp::sharded_pool;
 using ::sqlpp::normal_connection;
 using ::sqlpp::pooled_connection;
+using ::sqlpp::cached_prepared_statement_t;
+using ::sqlpp::cached_result;
+using ::sqlpp::caching_connection;
+using ::sqlpp::query_cache;
+using ::sqlpp::query_cache_options;
 
 // query
+using ::sqlpp::chunked_result;
+using ::sqlpp::column_batch;
+using ::sqlpp::column_buffer;
 using ::sqlpp::dynamic;
 using ::sqlpp::dynamic_t;
+using ::sqlpp::export_arrow_array;
+using ::sqlpp::export_arrow_schema;
+using ::sqlpp::export_arrow_stream;
+using ::sqlpp::fetch_arrow;
+using ::sqlpp::fetch_columns;
+using ::sqlpp::lazy_result;
+using ::sqlpp::lazy_row;
+using ::sqlpp::materialized_result;
+using ::sqlpp::owning_row_t;
+using ::sqlpp::prefetching_result;
+using ::sqlpp::result_chunk;
 
 // serialization
 using ::sqlpp::to_sql_string;
@@ -404,3 +446,8 @@ using ::sqlpp::logic::all;
 using ::sqlpp::logic::any;
 using ::sqlpp::logic::none;
 }
+
+// Arrow C data and stream interfaces
+export using ::ArrowArray;
+export using ::ArrowArrayStream;
+export using ::ArrowSchema;
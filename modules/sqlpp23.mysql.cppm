@@ -35,6 +35,8 @@ export namespace sqlpp::mysql {
 using ::sqlpp::mysql::connection;
 using ::sqlpp::mysql::connection_config;
 using ::sqlpp::mysql::connection_pool;
+using ::sqlpp::mysql::routing_pool;
+using ::sqlpp::mysql::sharded_pool;
 using ::sqlpp::mysql::pooled_connection;
 using ::sqlpp::mysql::context_t;
 
@@ -47,6 +49,7 @@ using ::sqlpp::mysql::global_library_init;
 using ::sqlpp::mysql::delete_from;
 using ::sqlpp::mysql::update;
 
+using ::sqlpp::mysql::assert_no_array_parameter_t;
 using ::sqlpp::mysql::assert_no_bool_cast;
 using ::sqlpp::mysql::assert_no_full_outer_join_t;
 
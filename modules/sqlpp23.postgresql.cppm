@@ -35,6 +35,8 @@ export namespace sqlpp::postgresql {
 using ::sqlpp::postgresql::connection;
 using ::sqlpp::postgresql::connection_config;
 using ::sqlpp::postgresql::connection_pool;
+using ::sqlpp::postgresql::routing_pool;
+using ::sqlpp::postgresql::sharded_pool;
 using ::sqlpp::postgresql::pooled_connection;
 using ::sqlpp::postgresql::context_t;
 
@@ -35,11 +35,18 @@ export namespace sqlpp::sqlite3 {
 using ::sqlpp::sqlite3::connection;
 using ::sqlpp::sqlite3::connection_config;
 using ::sqlpp::sqlite3::connection_pool;
+using ::sqlpp::sqlite3::routing_pool;
+using ::sqlpp::sqlite3::sharded_pool;
 using ::sqlpp::sqlite3::pooled_connection;
 using ::sqlpp::sqlite3::context_t;
 
 using ::sqlpp::sqlite3::command_result;
 using ::sqlpp::sqlite3::exception;
+using ::sqlpp::sqlite3::statement_status;
+using ::sqlpp::sqlite3::database_status;
+using ::sqlpp::sqlite3::scalar_function_t;
+using ::sqlpp::sqlite3::aggregate_function_t;
+using ::sqlpp::sqlite3::function_call_t;
 
 using ::sqlpp::sqlite3::delete_from;
 using ::sqlpp::sqlite3::update;
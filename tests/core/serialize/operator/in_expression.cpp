@@ -27,6 +27,7 @@
 #include <sqlpp23/tests/core/all.h>
 
 SQLPP_CREATE_NAME_TAG(v);
+SQLPP_CREATE_NAME_TAG(ids);
 
 int main(int, char*[]) {
   const auto val = sqlpp::value(17);
@@ -61,5 +62,14 @@ int main(int, char*[]) {
   SQLPP_COMPARE(val.in(std::vector<expr_t>{}), "17 IN ()");
   SQLPP_COMPARE(val.not_in(std::vector<expr_t>{}), "17 NOT IN ()");
 
+  // Array parameters bind all values at once.
+  const auto foo = test::TabFoo{};
+  SQLPP_COMPARE(foo.id.in(sqlpp::array_parameter(foo.id)),
+                "tab_foo.id = ANY(?)");
+  SQLPP_COMPARE(foo.id.not_in(sqlpp::array_parameter(foo.id)),
+                "tab_foo.id <> ALL(?)");
+  SQLPP_COMPARE(foo.intN.in(sqlpp::array_parameter(sqlpp::integral{}, ids)),
+                "tab_foo.int_n = ANY(?)");
+
   return 0;
 }
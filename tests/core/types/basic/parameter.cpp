@@ -91,6 +91,48 @@ void test_parameter() {
   }
 }
 
+void test_array_parameter() {
+  const auto foo = test::TabFoo{};
+
+  {
+    auto p = array_parameter(foo.intN);
+    using P = decltype(p);
+    static_assert(
+        std::is_same<P, sqlpp::array_parameter_t<
+                            sqlpp::integral,
+                            sqlpp::name_tag_of_t<decltype(foo.intN)>>>::value,
+        "");
+    static_assert(std::is_same<sqlpp::parameters_of_t<P>,
+                               sqlpp::detail::type_vector<P>>::value,
+                  "");
+
+    // Array parameters can only be used with in() and not_in().
+    static_assert(not sqlpp::has_data_type<P>::value, "");
+    static_assert(not sqlpp::has_name_tag<P>::value, "");
+    static_assert(not sqlpp::has_enabled_as<P>::value, "");
+    static_assert(not sqlpp::has_enabled_comparison<P>::value, "");
+
+    using E = decltype(foo.intN.in(p));
+    static_assert(std::is_same<sqlpp::data_type_of_t<E>,
+                               std::optional<sqlpp::boolean>>::value,
+                  "");
+    static_assert(std::is_same<sqlpp::parameters_of_t<E>,
+                               sqlpp::detail::type_vector<P>>::value,
+                  "");
+  }
+  {
+    auto p = array_parameter(sqlpp::text{}, something);
+    using P = decltype(p);
+    static_assert(std::is_same<sqlpp::parameters_of_t<P>,
+                               sqlpp::detail::type_vector<P>>::value,
+                  "");
+
+    using E = decltype(foo.textNnD.not_in(p));
+    static_assert(
+        std::is_same<sqlpp::data_type_of_t<E>, sqlpp::boolean>::value, "");
+  }
+}
+
 int main() {
   void test_column();
 }
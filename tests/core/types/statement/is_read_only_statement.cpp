@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/core/database/routing_pool.h>
+#include <sqlpp23/tests/core/all.h>
+
+void test_is_read_only_statement() {
+  const auto foo = test::TabFoo{};
+  const auto bar = test::TabBar{};
+
+  static_assert(not sqlpp::is_read_only_statement_v<int>);
+
+  // Selects can be executed on a read replica.
+  static_assert(sqlpp::is_read_only_statement_v<decltype(select(foo.id))>);
+  static_assert(sqlpp::is_read_only_statement_v<
+                decltype(select(foo.id).from(foo).where(true))>);
+  static_assert(sqlpp::is_read_only_statement_v<
+                decltype(select(foo.id).from(foo).where(true).union_all(
+                    select(bar.id).from(bar).where(true)))>);
+
+  // Selects that lock rows cannot.
+  static_assert(not sqlpp::is_read_only_statement_v<
+                decltype(select(foo.id).from(foo).where(true).for_update())>);
+
+  // Neither can any other statement.
+  static_assert(not sqlpp::is_read_only_statement_v<
+                decltype(insert_into(foo).default_values())>);
+  static_assert(not sqlpp::is_read_only_statement_v<
+                decltype(update(foo).set(foo.intN = 5).where(true))>);
+  static_assert(not sqlpp::is_read_only_statement_v<
+                decltype(delete_from(foo).where(true))>);
+}
+
+int main() {
+  void test_is_read_only_statement();
+}
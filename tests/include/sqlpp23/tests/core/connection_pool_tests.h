@@ -27,8 +27,12 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <optional>
 #include <random>
+#include <source_location>
 #include <thread>
 #include <unordered_set>
 
@@ -240,6 +244,232 @@ void test_destruction_order(typename Pool::_config_ptr_t config) {
   auto conn = pool->get();
   pool = nullptr;
 }
+
+template <typename Pool>
+void test_max_size(typename Pool::_config_ptr_t config) {
+  std::clog << __func__ << '\n';
+  auto pool = Pool{config, connection_pool_options{
+                               .capacity = 2,
+                               .max_size = 2,
+                               .acquire_timeout = std::chrono::milliseconds{200},
+                           }};
+  auto conn_1 = pool.get();
+  auto conn_2 = pool.get();
+
+  // The pool does not open more than max_size connections.
+  try {
+    pool.get();
+    throw std::logic_error{"Pool exceeded its maximum size"};
+  } catch (const connection_pool_timeout&) {
+  }
+
+  // A returned connection is handed over to the waiting caller.
+  const auto handle = conn_1.native_handle();
+  auto releaser = std::thread{[conn = std::move(conn_1)]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+  }};
+  auto conn_3 = pool.get();
+  releaser.join();
+  if (conn_3.native_handle() != handle) {
+    throw std::logic_error{"Waiting caller did not get the returned connection"};
+  }
+}
+
+// Callers that are already waiting are served before new callers of get().
+template <typename Pool>
+void test_fifo_handoff(typename Pool::_config_ptr_t config) {
+  std::clog << __func__ << '\n';
+  auto pool = Pool{config, connection_pool_options{
+                               .max_size = 1,
+                               .acquire_timeout = std::chrono::seconds{5},
+                           }};
+  auto conn = std::optional<pool_conn_type<Pool>>{pool.get()};
+
+  auto waiter_served = std::atomic<bool>{false};
+  auto waiter = std::thread{[&pool, &waiter_served]() {
+    auto c = pool.get();
+    waiter_served = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+  }};
+  for (auto i = 0; i < 500 and pool.stats().waiting == 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+
+  // The returned connection goes to the waiting thread, not to this one.
+  conn.reset();
+  auto next = pool.get();
+  waiter.join();
+  if (not waiter_served) {
+    throw std::logic_error{"A new caller overtook a waiting caller"};
+  }
+}
+
+template <typename Pool>
+void test_min_idle(typename Pool::_config_ptr_t config) {
+  std::clog << __func__ << '\n';
+  auto pool = Pool{config, connection_pool_options{
+                               .min_idle = 3,
+                               .maintenance_interval =
+                                   std::chrono::milliseconds{10},
+                           }};
+  // Connections are opened upfront.
+  if (pool.available() != 3) {
+    throw std::logic_error{"Pool did not open min_idle connections"};
+  }
+
+  // Connections in use are replaced in the background.
+  auto connections = std::vector<pool_conn_type<Pool>>{};
+  connections.push_back(pool.get());
+  connections.push_back(pool.get());
+  for (auto i = 0; i < 100 and pool.available() < 3; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+  }
+  if (pool.available() != 3) {
+    throw std::logic_error{"Pool did not replenish idle connections"};
+  }
+}
+
+template <typename Pool>
+void wait_for_available(Pool& pool, std::size_t expected) {
+  for (auto i = 0; i < 100 and pool.available() != expected; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+  }
+}
+
+template <typename Pool>
+void test_expiry(typename Pool::_config_ptr_t config) {
+  std::clog << __func__ << '\n';
+  {
+    auto pool = Pool{config, connection_pool_options{
+                                 .min_idle = 1,
+                                 .idle_timeout = std::chrono::milliseconds{20},
+                                 .maintenance_interval =
+                                     std::chrono::milliseconds{10},
+                             }};
+    {
+      auto c1 = pool.get();
+      auto c2 = pool.get();
+      auto c3 = pool.get();
+    }
+    // Idle connections are closed down to min_idle.
+    wait_for_available(pool, 1);
+    if (pool.available() != 1) {
+      throw std::logic_error{"Idle connections were not closed"};
+    }
+  }
+  {
+    auto pool = Pool{config, connection_pool_options{
+                                 .max_lifetime = std::chrono::milliseconds{50},
+                                 .idle_check = connection_check::ping,
+                                 .maintenance_interval =
+                                     std::chrono::milliseconds{10},
+                             }};
+    // Idle connections are closed at the end of their lifetime.
+    pool.get();
+    wait_for_available(pool, 0);
+    if (pool.available() != 0) {
+      throw std::logic_error{"Idle connection outlived max_lifetime"};
+    }
+    // Connections in use are closed when they are returned.
+    {
+      auto db = pool.get();
+      std::this_thread::sleep_for(std::chrono::milliseconds{60});
+    }
+    if (pool.available() != 0) {
+      throw std::logic_error{"Returned connection outlived max_lifetime"};
+    }
+  }
+}
+
+template <typename Pool>
+void test_stats(typename Pool::_config_ptr_t config) {
+  std::clog << __func__ << '\n';
+  auto pool = Pool{config, connection_pool_options{.max_size = 2}};
+  {
+    auto c1 = pool.get();
+    auto c2 = pool.get();
+    const auto stats = pool.stats();
+    if (stats.total != 2 or stats.idle != 0 or stats.in_use != 2 or
+        stats.created != 2 or stats.acquire_time.count != 2) {
+      throw std::logic_error{"Unexpected stats with connections in use"};
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{2});
+  }
+  pool.get();
+  const auto stats = pool.stats();
+  if (stats.total != 2 or stats.idle != 2 or stats.in_use != 0 or
+      stats.created != 2 or stats.closed != 0 or stats.timeouts != 0 or
+      stats.acquire_time.count != 3 or stats.held_time.count != 3) {
+    throw std::logic_error{"Unexpected stats with idle connections"};
+  }
+  if (stats.held_time.max < std::chrono::milliseconds{2} or
+      stats.held_time.quantile(1.0) != stats.held_time.max) {
+    throw std::logic_error{"Unexpected held time"};
+  }
+}
+
+template <typename Pool>
+void test_clear_idle(typename Pool::_config_ptr_t config) {
+  std::clog << __func__ << '\n';
+  auto pool = Pool{config, connection_pool_options{}};
+  {
+    auto c1 = pool.get();
+    auto c2 = pool.get();
+    auto c3 = pool.get();
+  }
+  if (pool.available() != 3) {
+    throw std::logic_error{"Connections were not returned to the pool"};
+  }
+  auto db = pool.get();
+  pool.clear_idle();
+  if (pool.available() != 0 or pool.stats().closed != 2 or
+      pool.stats().in_use != 1) {
+    throw std::logic_error{"Idle connections were not closed"};
+  }
+}
+
+template <typename Pool>
+void test_leak_detection(typename Pool::_config_ptr_t config) {
+  std::clog << __func__ << '\n';
+  auto leaks = std::atomic<int>{0};
+  auto leak_line = std::atomic<std::uint_least32_t>{0};
+  auto pool = Pool{
+      config,
+      connection_pool_options{
+          .leak_threshold = std::chrono::milliseconds{20},
+          .on_leak =
+              [&](const held_connection& held) {
+                leak_line = held.location.line();
+                ++leaks;
+              },
+          .track_call_sites = true,
+          .maintenance_interval = std::chrono::milliseconds{10}}};
+  {
+    const auto line = std::source_location::current().line() + 1;
+    auto db = pool.get();
+    for (int i = 0; i < 100 and leaks == 0; ++i) {
+      std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    if (leaks != 1 or leak_line != line) {
+      throw std::logic_error{"Leaked connection was not reported"};
+    }
+    // Each checkout is reported only once
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    if (leaks != 1) {
+      throw std::logic_error{"Leaked connection was reported twice"};
+    }
+    if (pool.call_sites().size() != 1 or pool.call_sites()[0].in_use != 1) {
+      throw std::logic_error{"Held connection is not in the call sites"};
+    }
+  }
+  pool.get();
+  const auto sites = pool.call_sites();
+  if (sites.size() != 2 or sites[0].checkouts != 1 or sites[0].in_use != 0 or
+      sites[0].max_held < std::chrono::milliseconds{20} or
+      sites[0].total_held < sites[1].total_held) {
+    throw std::logic_error{"Unexpected call site stats"};
+  }
+}
 }  // namespace
 
 template <typename Pool>
@@ -255,5 +485,14 @@ void test_connection_pool(typename Pool::_config_ptr_t config,
     test_multithreaded(pool);
   }
   test_destruction_order<Pool>(config);
+  test_max_size<Pool>(config);
+  if (test_mt) {
+    test_fifo_handoff<Pool>(config);
+  }
+  test_min_idle<Pool>(config);
+  test_expiry<Pool>(config);
+  test_stats<Pool>(config);
+  test_clear_idle<Pool>(config);
+  test_leak_detection<Pool>(config);
 }
 }  // namespace sqlpp::test
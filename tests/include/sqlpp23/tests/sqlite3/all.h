@@ -47,7 +47,11 @@ import sqlpp23.core;
 import sqlpp23.sqlite3;
 import sqlpp23.test.sqlite3.tables;
 #else
+#include <sqlpp23/core/database/caching_connection.h>
 #include <sqlpp23/core/database/connection_pool.h>
+#include <sqlpp23/core/query/arrow.h>
+#include <sqlpp23/core/query/chunked_result.h>
+#include <sqlpp23/core/query/prefetching_result.h>
 #include <sqlpp23/sqlite3/sqlite3.h>
 #include <sqlpp23/sqlpp23.h>
 #include <sqlpp23/tests/sqlite3/tables.h>
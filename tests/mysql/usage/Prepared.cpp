@@ -63,6 +63,30 @@ void testPreparedStatementResult(sql::connection& db) {
   db(preparedUpdateAll);
 }
 
+// Results of repeated executions reuse the buffers of earlier ones, which must
+// not leak into the values of shorter or longer texts.
+void testRepeatedPreparedSelect(sql::connection& db) {
+  db(truncate(tab));
+  const auto texts =
+      std::vector<std::string>{"short", std::string(10000, 'x'), "", "medium"};
+  for (const auto& text : texts) {
+    db(insert_into(tab).set(tab.textN = text, tab.boolNn = true));
+  }
+
+  auto prepared = db.prepare(
+      sqlpp::select(tab.textN).from(tab).where(tab.id == parameter(tab.id)));
+  for (int round = 0; round < 3; ++round) {
+    for (std::size_t i = 0; i < texts.size(); ++i) {
+      prepared.parameters.id = static_cast<int64_t>(i + 1);
+      auto result = db(prepared);
+      if (result.front().textN != texts[i]) {
+        throw std::runtime_error("unexpected text for id " +
+                                 std::to_string(i + 1));
+      }
+    }
+  }
+}
+
 int Prepared(int, char*[]) {
   sql::global_library_init();
   try {
@@ -70,6 +94,7 @@ int Prepared(int, char*[]) {
     test::createTabBar(db);
 
     testPreparedStatementResult(db);
+    testRepeatedPreparedSelect(db);
   } catch (const std::exception& e) {
     std::cerr << "Exception: " << e.what() << std::endl;
     return 1;
@@ -115,5 +115,15 @@ int main() {
           foo.intN = parameter(foo.intN), foo.textNnD = parameter(foo.textNnD)),
       " ON CONFLICT (id) DO UPDATE SET int_n = $1, text_nn_d = $2");
 
+  // Array parameters
+  SQLPP_COMPARE(foo.id.in(array_parameter(foo.id)), "tab_foo.id = ANY($1)");
+  SQLPP_COMPARE(foo.id.not_in(array_parameter(foo.id)),
+                "tab_foo.id <> ALL($1)");
+  SQLPP_COMPARE(select(foo.id).from(foo).where(
+                    foo.intN > parameter(foo.intN) and
+                    foo.textNnD.in(array_parameter(sqlpp::text{}, something))),
+                "SELECT tab_foo.id FROM tab_foo WHERE (tab_foo.int_n > $1) AND "
+                "(tab_foo.text_nn_d = ANY($2))");
+
   return 0;
 }
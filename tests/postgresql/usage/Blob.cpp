@@ -105,5 +105,22 @@ int Blob(int, char*[]) {
     }
   }
 
+  // Repeated executions reuse the blob buffers of earlier results
+  {
+    auto prepared_select = db.prepare(
+        select(blob.data).from(blob).where(blob.id == parameter(blob.id)));
+    const auto expected_blobs =
+        std::vector<std::pair<uint64_t, const std::vector<uint8_t>*>>{
+            {id, &data_smaller}, {prep_id, &data}, {id, &data_smaller}};
+    for (const auto& [blob_id, expected] : expected_blobs) {
+      prepared_select.parameters.id = static_cast<int64_t>(blob_id);
+      auto result = db(prepared_select);
+      const auto& received = result.front().data;
+      if (not received or not std::ranges::equal(*received, *expected)) {
+        throw std::runtime_error("Prepared select returned unexpected blob");
+      }
+    }
+  }
+
   return 0;
 }
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/postgresql/all.h>
+
+int ConnectionConfig(int, char*[]) {
+  namespace sql = sqlpp::postgresql;
+  using config_t = sql::connection_config;
+
+  {
+    auto config = config_t{};
+    config.host = "localhost";
+    config.dbname = "test";
+    assert(sql::detail::make_conninfo(config) ==
+           "host=localhost dbname=test");
+  }
+
+  // Endpoints replace host and port.
+  {
+    auto config = config_t{};
+    config.host = "ignored";
+    config.port = 1234;
+    config.endpoints = {{"db1", 5432}, {"db2", 5433}, {"db3", 5432}};
+    config.dbname = "test";
+    config.target_session_attrs = config_t::target_session_attrs_t::read_write;
+    config.load_balance_hosts = config_t::load_balance_hosts_t::random;
+    assert(sql::detail::make_conninfo(config) ==
+           "host=db1,db2,db3 port=5432,5433,5432 dbname=test "
+           "target_session_attrs=read-write load_balance_hosts=random");
+  }
+
+  {
+    auto config = config_t{};
+    config.endpoints = {{"standby", 5432}};
+    config.target_session_attrs =
+        config_t::target_session_attrs_t::prefer_standby;
+    assert(sql::detail::make_conninfo(config) ==
+           "host=standby port=5432 target_session_attrs=prefer-standby");
+  }
+
+  // Endpoints and session attributes are part of the configuration.
+  {
+    auto lhs = config_t{};
+    auto rhs = config_t{};
+    assert(lhs == rhs);
+    rhs.endpoints = {{"db1", 5432}};
+    assert(lhs != rhs);
+    lhs.endpoints = {{"db1", 5432}};
+    assert(lhs == rhs);
+    rhs.target_session_attrs = config_t::target_session_attrs_t::primary;
+    assert(lhs != rhs);
+  }
+
+  // Server state is matched with libpq's rules.
+  {
+    using attrs = config_t::target_session_attrs_t;
+    const auto matches = [](attrs target, const char* in_hot_standby,
+                            const char* default_transaction_read_only) {
+      return sql::detail::matches_target_session_attrs(
+          target, in_hot_standby, default_transaction_read_only);
+    };
+    // A primary.
+    assert(matches(attrs::read_write, "off", "off"));
+    assert(not matches(attrs::read_only, "off", "off"));
+    assert(matches(attrs::primary, "off", "off"));
+    assert(not matches(attrs::standby, "off", "off"));
+    // A primary with default_transaction_read_only=on is read-only, but still a
+    // primary.
+    assert(not matches(attrs::read_write, "off", "on"));
+    assert(matches(attrs::read_only, "off", "on"));
+    assert(matches(attrs::primary, "off", "on"));
+    assert(not matches(attrs::standby, "off", "on"));
+    // A standby.
+    assert(not matches(attrs::read_write, "on", "off"));
+    assert(matches(attrs::read_only, "on", "off"));
+    assert(not matches(attrs::primary, "on", "off"));
+    assert(matches(attrs::standby, "on", "off"));
+    assert(matches(attrs::prefer_standby, "off", "off"));
+    assert(matches(attrs::any, "on", "on"));
+    // Servers before PostgreSQL 14 do not report their state.
+    assert(matches(attrs::standby, nullptr, nullptr));
+    assert(matches(attrs::read_write, nullptr, nullptr));
+  }
+
+  return 0;
+}
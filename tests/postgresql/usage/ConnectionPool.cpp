@@ -33,6 +33,24 @@ int ConnectionPool(int, char*[]) {
   namespace test = sqlpp::test;
 
   try {
+    // Connections are opened concurrently without additional threads.
+    {
+      auto opening = sql::detail::connection_handle::connect_many(
+          sql::make_test_config(), 5);
+      assert(opening.size() == 5);
+      for (auto& handle : opening) {
+        assert(handle.get().is_connected());
+      }
+    }
+    {
+      auto config = sql::make_test_config();
+      config->dbname = "sqlpp23_nonexistent_database";
+      auto opening = sql::detail::connection_handle::connect_many(config, 2);
+      for (auto& handle : opening) {
+        assert_throw(handle.get(), sql::connection_exception);
+      }
+    }
+
     test::test_connection_pool<sql::connection_pool>(
         sql::make_test_config(),
         PQisthreadsafe());
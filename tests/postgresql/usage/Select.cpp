@@ -123,6 +123,21 @@ int Select(int, char*[]) {
                  .front()
                  .boolN.has_value());
 
+  // array parameters
+  {
+    auto prepared = db.prepare(select(tab.id).from(tab).where(
+        tab.textNnD.in(array_parameter(tab.textNnD))));
+    prepared.parameters.textNnD = {"asdf", "cheesecake", "with \"quotes\""};
+    assert(db(prepared).size() == 3);
+    prepared.parameters.textNnD = {};
+    assert(db(prepared).empty());
+
+    auto prepared_ids = db.prepare(
+        select(tab.id).from(tab).where(tab.id.not_in(array_parameter(tab.id))));
+    prepared_ids.parameters.id = {1, 2};
+    assert(db(prepared_ids).size() == 3);
+  }
+
   // test
 
   // update
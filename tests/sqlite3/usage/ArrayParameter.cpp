@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace {
+SQLPP_CREATE_NAME_TAG(texts);
+
+template <typename Db, typename Statement>
+size_t count_rows(Db& db, Statement& statement) {
+  size_t rows = 0;
+  for (const auto& row : db(statement)) {
+    std::ignore = row;
+    ++rows;
+  }
+  return rows;
+}
+}  // namespace
+
+int ArrayParameter(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+  for (int i = 0; i < 1000; ++i) {
+    db(insert_into(foo).set(foo.intN = i, foo.doubleN = i / 2.0,
+                            foo.textNnD = std::to_string(i)));
+  }
+  db(insert_into(foo).set(foo.textNnD = "quote\"back\\slash\ttab"));
+
+  // The statement is prepared once, independent of the number of values.
+  auto in_ints = db.prepare(
+      select(foo.id).from(foo).where(foo.intN.in(array_parameter(foo.intN))));
+  in_ints.parameters.intN = {};
+  assert(count_rows(db, in_ints) == 0);
+  in_ints.parameters.intN = {1, 2, 3, 2000};
+  assert(count_rows(db, in_ints) == 3);
+  in_ints.parameters.intN.clear();
+  for (int64_t i = 0; i < 1000; i += 2) {
+    in_ints.parameters.intN.push_back(i);
+  }
+  assert(count_rows(db, in_ints) == 500);
+
+  auto not_in_ints = db.prepare(select(foo.id).from(foo).where(
+      foo.intN.not_in(array_parameter(foo.intN))));
+  not_in_ints.parameters.intN = {1, 2, 3};
+  assert(count_rows(db, not_in_ints) == 997);
+
+  auto in_doubles = db.prepare(select(foo.id).from(foo).where(
+      foo.doubleN.in(array_parameter(foo.doubleN))));
+  in_doubles.parameters.doubleN = {0.5, 1.0, 1.25};
+  assert(count_rows(db, in_doubles) == 2);
+
+  // Text values are escaped.
+  auto in_texts = db.prepare(select(foo.id).from(foo).where(
+      foo.textNnD.in(array_parameter(sqlpp::text{}, texts))));
+  in_texts.parameters.texts = {"17", "quote\"back\\slash\ttab", "nope"};
+  assert(count_rows(db, in_texts) == 2);
+
+#if SQLITE_VERSION_NUMBER >= 3041000
+  // Blob values are bound as hex strings.
+  db(insert_into(foo).set(foo.textNnD = "blob",
+                          foo.blobN = std::vector<uint8_t>{0, 1, 254, 255}));
+  db(insert_into(foo).set(foo.textNnD = "blob",
+                          foo.blobN = std::vector<uint8_t>{}));
+  auto in_blobs = db.prepare(select(foo.id).from(foo).where(
+      foo.blobN.in(array_parameter(foo.blobN))));
+  in_blobs.parameters.blobN = {{0, 1, 254, 255}, {0, 1}};
+  assert(count_rows(db, in_blobs) == 1);
+  in_blobs.parameters.blobN = {{}, {0, 1, 254, 255}};
+  assert(count_rows(db, in_blobs) == 2);
+#endif
+
+  return 0;
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstring>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace {
+bool is_set(const void* bitmap, std::size_t row) {
+  return (static_cast<const std::uint8_t*>(bitmap)[row / 8] >> (row % 8)) & 1;
+}
+}  // namespace
+
+int ArrowExport(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  const auto date_time = test::TabDateTime{};
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+  test::createTabDateTime(db);
+
+  for (int64_t i = 0; i < 10; ++i) {
+    db(insert_into(foo).set(
+        foo.textNnD = "row " + std::to_string(i),
+        foo.intN = i % 2 == 0 ? std::make_optional(i) : std::nullopt,
+        foo.boolN = i % 3 == 0));
+  }
+  const auto today =
+      std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now());
+  db(insert_into(date_time).set(date_time.dateN = today));
+
+  // Schema
+  {
+    auto result = db(select(foo.id, foo.textNnD, foo.intN, foo.boolN)
+                         .from(foo)
+                         .where(true));
+    auto schema = ArrowSchema{};
+    sqlpp::export_arrow_schema(result, &schema);
+    assert(std::strcmp(schema.format, "+s") == 0);
+    assert(schema.n_children == 4);
+    assert(std::strcmp(schema.children[0]->name, "id") == 0);
+    assert(std::strcmp(schema.children[0]->format, "l") == 0);
+    assert(schema.children[0]->flags == 0);
+    assert(std::strcmp(schema.children[1]->name, "text_nn_d") == 0);
+    assert(std::strcmp(schema.children[1]->format, "U") == 0);
+    assert(std::strcmp(schema.children[2]->format, "l") == 0);
+    assert(schema.children[2]->flags == 2);  // ARROW_FLAG_NULLABLE
+    assert(std::strcmp(schema.children[3]->format, "b") == 0);
+    schema.release(&schema);
+    assert(schema.release == nullptr);
+  }
+
+  // Arrays in batches
+  {
+    auto result = db(select(foo.id, foo.textNnD, foo.intN, foo.boolN)
+                         .from(foo)
+                         .where(true));
+    auto array = ArrowArray{};
+    assert(sqlpp::fetch_arrow(result, &array, 6) == 6);
+    assert(array.length == 6);
+    assert(array.n_children == 4);
+
+    const auto* ids = array.children[0];
+    assert(ids->null_count == 0);
+    assert(ids->buffers[0] == nullptr);
+    assert(static_cast<const int64_t*>(ids->buffers[1])[5] == 6);
+
+    const auto* texts = array.children[1];
+    const auto* offsets = static_cast<const int64_t*>(texts->buffers[1]);
+    const auto* chars = static_cast<const char*>(texts->buffers[2]);
+    assert(std::string_view(chars + offsets[2], offsets[3] - offsets[2]) ==
+           "row 2");
+
+    const auto* ints = array.children[2];
+    assert(ints->null_count == 3);
+    assert(is_set(ints->buffers[0], 0) and not is_set(ints->buffers[0], 1));
+    assert(static_cast<const int64_t*>(ints->buffers[1])[4] == 4);
+
+    // Consumers may move children out of the parent.
+    auto bools = *array.children[3];
+    array.children[3]->release = nullptr;
+    array.release(&array);
+    assert(bools.length == 6);
+    assert(is_set(bools.buffers[1], 3) and not is_set(bools.buffers[1], 4));
+    bools.release(&bools);
+
+    assert(sqlpp::fetch_arrow(result, &array, 6) == 4);
+    assert(array.length == 4);
+    array.release(&array);
+    assert(sqlpp::fetch_arrow(result, &array, 6) == 0);
+    assert(array.length == 0);
+    array.release(&array);
+  }
+
+  // Stream
+  {
+    auto stream = ArrowArrayStream{};
+    sqlpp::export_arrow_stream(
+        db(select(foo.id, foo.blobN).from(foo).where(true)), &stream, 4);
+    auto schema = ArrowSchema{};
+    assert(stream.get_schema(&stream, &schema) == 0);
+    assert(std::strcmp(schema.children[1]->format, "Z") == 0);
+    schema.release(&schema);
+
+    auto lengths = std::vector<int64_t>{};
+    for (;;) {
+      auto array = ArrowArray{};
+      assert(stream.get_next(&stream, &array) == 0);
+      if (array.release == nullptr) {
+        break;
+      }
+      lengths.push_back(array.length);
+      assert(array.children[1]->null_count == array.length);
+      array.release(&array);
+    }
+    assert((lengths == std::vector<int64_t>{4, 4, 2}));
+    assert(stream.get_last_error(&stream) == nullptr);
+    stream.release(&stream);
+  }
+
+  // Dates are exported as 32 bit days
+  {
+    auto result = db(select(date_time.dateN).from(date_time).where(true));
+    auto array = ArrowArray{};
+    sqlpp::fetch_arrow(result, &array);
+    assert(static_cast<const int32_t*>(array.children[0]->buffers[1])[0] ==
+           today.time_since_epoch().count());
+    array.release(&array);
+  }
+
+  return 0;
+}
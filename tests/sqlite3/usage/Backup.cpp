@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <filesystem>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace {
+template <typename Db>
+size_t count_rows(Db& db) {
+  const auto foo = test::TabFoo{};
+  size_t rows = 0;
+  for (const auto& row : db(select(foo.id).from(foo))) {
+    std::ignore = row;
+    ++rows;
+  }
+  return rows;
+}
+}  // namespace
+
+int Backup(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+  for (int i = 0; i < 100; ++i) {
+    db(insert_into(foo).set(foo.intN = i, foo.textNnD = "backup"));
+  }
+
+  // Snapshot into a byte buffer and reload it into another connection.
+  {
+    const auto image = db.serialize();
+    assert(not image.empty());
+
+    auto other = sql::make_test_connection();
+    other.deserialize(image);
+    assert(count_rows(other) == 100);
+
+    // The deserialized database is writable.
+    other(insert_into(foo).default_values());
+    assert(count_rows(other) == 101);
+    assert(count_rows(db) == 100);
+  }
+
+  // An empty database serializes to nothing.
+  assert(sql::make_test_connection().serialize().empty());
+
+  // Backup to a file and restore from it, a few pages at a time.
+  const auto path =
+      (std::filesystem::temp_directory_path() / "sqlpp23_sqlite3_backup.db")
+          .string();
+  std::filesystem::remove(path);
+
+  db.backup_to(path, 2);
+  {
+    auto other = sql::make_test_connection();
+    other.restore_from(path, 2);
+    assert(count_rows(other) == 100);
+  }
+
+  // Backing up again replaces the contents of the file.
+  db(delete_from(foo).where(foo.intN < 50));
+  db.backup_to(path);
+  {
+    auto other = sql::make_test_connection();
+    other.restore_from(path);
+    assert(count_rows(other) == 50);
+  }
+  std::filesystem::remove(path);
+
+#ifdef SQLITE_HAS_CODEC
+  // Backups of encrypted databases are encrypted with the same key.
+  {
+    const auto source_path =
+        (std::filesystem::temp_directory_path() / "sqlpp23_sqlite3_keyed.db")
+            .string();
+    std::filesystem::remove(source_path);
+
+    auto config = sql::make_test_config();
+    config->path_to_database = source_path;
+    config->password = "secret";
+    {
+      auto keyed = sql::connection{config};
+      test::createTabFoo(keyed);
+      keyed(insert_into(foo).default_values());
+      keyed.backup_to(path);
+    }
+
+    auto backup_config = std::make_shared<sql::connection_config>(*config);
+    backup_config->path_to_database = path;
+    {
+      auto keyed = sql::connection{backup_config};
+      assert(count_rows(keyed) == 1);
+
+      keyed(insert_into(foo).default_values());
+      keyed.backup_to(source_path);
+    }
+    {
+      auto keyed = sql::connection{config};
+      keyed.restore_from(path);
+      assert(count_rows(keyed) == 2);
+    }
+
+    // The backup cannot be read without the key.
+    backup_config->password.clear();
+    {
+      auto plain = sql::connection{backup_config};
+      assert_throw(count_rows(plain), sql::exception);
+    }
+    std::filesystem::remove(source_path);
+    std::filesystem::remove(path);
+  }
+#endif
+
+  // Restoring from a missing file fails.
+  assert_throw(db.restore_from(path), sql::exception);
+
+  return 0;
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <filesystem>
+#include <thread>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int CachingConnection(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  const auto bar = test::TabBar{};
+  auto cache = std::make_shared<sqlpp::query_cache>(
+      sqlpp::query_cache_options{.ttl = std::chrono::hours{1}});
+  auto db = sqlpp::caching_connection{sql::make_test_connection(), cache};
+  test::createTabFoo(db.connection());
+  test::createTabBar(db.connection());
+
+  db(insert_into(foo).set(foo.textNnD = "a", foo.intN = 1));
+  db(insert_into(bar).set(bar.boolNn = true, bar.intN = 1));
+
+  const auto count_rows = [](auto&& rows) {
+    std::size_t count = 0;
+    for ([[maybe_unused]] const auto& row : rows) {
+      ++count;
+    }
+    return count;
+  };
+
+  // Rows are cached
+  const auto select_foo = select(foo.id, foo.textNnD).from(foo).where(true);
+  {
+    auto rows = db(select_foo);
+    assert(not rows.empty());
+    assert(rows.front().textNnD == "a");
+    assert(cache->size() == 1);
+  }
+
+  // Changes that bypass the caching_connection are not seen
+  db.connection()(update(foo).set(foo.textNnD = "b").where(true));
+  assert(db(select_foo).front().textNnD == "a");
+
+  // Writes through the caching_connection invalidate
+  db(update(foo).set(foo.intN = 2).where(true));
+  assert(cache->size() == 0);
+  assert(db(select_foo).front().textNnD == "b");
+
+  // Writes to other tables do not invalidate
+  db(insert_into(bar).set(bar.boolNn = false));
+  assert(cache->size() == 1);
+
+  // Tables of sub selects are taken into account
+  const auto select_sub =
+      select(foo.id)
+          .from(foo)
+          .where(foo.intN.in(select(bar.intN).from(bar).where(true)));
+  assert(count_rows(db(select_sub)) == 0);
+  assert(cache->size() == 2);
+  db(update(bar).set(bar.intN = 2).where(true));
+  assert(cache->size() == 1);
+  assert(count_rows(db(select_sub)) == 1);
+
+  // Parameter values are part of the key
+  {
+    auto prepared = db.prepare(
+        select(foo.textNnD).from(foo).where(foo.id == parameter(foo.id)));
+    db.connection()(insert_into(foo).set(foo.textNnD = "c"));
+    cache->clear();
+    prepared.parameters.id = 1;
+    assert(db(prepared).front().textNnD == "b");
+    prepared.parameters.id = 2;
+    assert(db(prepared).front().textNnD == "c");
+    assert(cache->size() == 2);
+    db.connection()(update(foo).set(foo.textNnD = "d").where(true));
+    assert(db(prepared).front().textNnD == "c");
+
+    auto prepared_delete =
+        db.prepare(delete_from(foo).where(foo.id == parameter(foo.id)));
+    prepared_delete.parameters.id = 2;
+    db(prepared_delete);
+    assert(cache->size() == 0);
+    assert(db(prepared).empty());
+    cache->clear();
+  }
+
+  // Invalidating explicitly
+  assert(not db(select_foo).empty());
+  cache->invalidate("tab_bar");
+  assert(cache->size() == 1);
+  cache->invalidate("tab_foo");
+  assert(cache->size() == 0);
+
+  // String statements drop all entries
+  db(select_foo);
+  db("DELETE FROM tab_bar");
+  assert(cache->size() == 0);
+
+  // Entries expire
+  {
+    auto short_lived = sqlpp::caching_connection{
+        sql::make_test_connection(),
+        std::make_shared<sqlpp::query_cache>(sqlpp::query_cache_options{
+            .ttl = std::chrono::milliseconds{10}})};
+    test::createTabFoo(short_lived.connection());
+    short_lived(insert_into(foo).set(foo.textNnD = "x"));
+    assert(short_lived(select_foo).front().textNnD == "x");
+    short_lived.connection()(update(foo).set(foo.textNnD = "y").where(true));
+    assert(short_lived(select_foo).front().textNnD == "x");
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    assert(short_lived(select_foo).front().textNnD == "y");
+  }
+
+  // The cache is bounded
+  {
+    auto small = sqlpp::caching_connection{
+        sql::make_test_connection(),
+        std::make_shared<sqlpp::query_cache>(
+            sqlpp::query_cache_options{.max_entries = 2})};
+    test::createTabFoo(small.connection());
+    small(select(foo.id).from(foo).where(foo.id == 1));
+    small(select(foo.id).from(foo).where(foo.id == 2));
+    small(select(foo.id).from(foo).where(foo.id == 3));
+    assert(small.cache().size() == 2);
+  }
+
+  // Selects within a transaction bypass the cache. Written tables are dropped
+  // on commit, as other connections may have cached their old rows meanwhile.
+  {
+    const auto path = (std::filesystem::temp_directory_path() /
+                       "sqlpp23_sqlite3_caching_connection.db")
+                          .string();
+    std::filesystem::remove(path);
+    auto config = sql::make_test_config();
+    config->path_to_database = path;
+    auto shared = std::make_shared<sqlpp::query_cache>();
+    auto writer = sqlpp::caching_connection{sql::connection{config}, shared};
+    auto reader = sqlpp::caching_connection{sql::connection{config}, shared};
+    test::createTabFoo(writer.connection());
+    {
+      auto tx = start_transaction(writer);
+      assert(writer.is_transaction_active());
+      writer(insert_into(foo).set(foo.textNnD = "tx"));
+      assert(count_rows(writer(select_foo)) == 1);
+      assert(shared->size() == 0);
+
+      // The uncommitted row is not seen by other connections.
+      assert(reader(select_foo).empty());
+      assert(shared->size() == 1);
+      tx.commit();
+    }
+    assert(not writer.is_transaction_active());
+    assert(shared->size() == 0);
+    assert(count_rows(reader(select_foo)) == 1);
+
+    // Nothing is dropped on rollback.
+    {
+      auto tx = start_transaction(writer);
+      writer(insert_into(foo).set(foo.textNnD = "rolled back"));
+    }
+    assert(not writer.is_transaction_active());
+    assert(shared->size() == 1);
+    assert(count_rows(writer(select_foo)) == 1);
+    std::filesystem::remove(path);
+  }
+
+  return 0;
+}
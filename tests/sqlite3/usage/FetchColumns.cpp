@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int FetchColumns(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+
+  for (int64_t i = 0; i < 20; ++i) {
+    db(insert_into(foo).set(
+        foo.textNnD = "row " + std::to_string(i),
+        foo.intN = i % 2 == 0 ? std::make_optional(i) : std::nullopt,
+        foo.boolN = i % 3 == 0));
+  }
+
+  // Whole result
+  {
+    const auto batch = sqlpp::fetch_columns(
+        db(select(foo.id, foo.textNnD, foo.intN).from(foo).where(true)));
+    assert(batch.size() == 20);
+    assert(batch.id.values().size() == 20);
+    assert(batch.id.validity().empty());
+    assert(batch.textNnD.offsets().size() == 21);
+    assert(batch.intN.validity().size() == 3);
+    for (std::size_t i = 0; i < 20; ++i) {
+      assert(batch.id[i] == static_cast<int64_t>(i + 1));
+      assert(batch.textNnD[i] == "row " + std::to_string(i));
+      assert(batch.intN.is_null(i) == (i % 2 == 1));
+      assert(batch.intN.values()[i] == (i % 2 == 0 ? int64_t(i) : 0));
+    }
+    assert(batch.intN[1] == std::nullopt);
+    assert(batch.intN[2] == 2);
+  }
+
+  // Batches, reusing the buffers, then rows
+  {
+    auto result = db(select(foo.id, foo.boolN).from(foo).where(true));
+    auto batch = sqlpp::fetch_columns(result, 8);
+    assert(batch.size() == 8);
+    batch.clear();
+    assert(sqlpp::fetch_columns(result, batch, 8) == 8);
+    assert(batch.size() == 8);
+    assert(batch.id[0] == 9);
+    assert(batch.boolN[0] == true);
+    assert(batch.boolN.values()[1] == 0);
+
+    assert(result.front().id == 17);
+    result.pop_front();
+    assert(sqlpp::fetch_columns(result, batch, 8) == 3);
+    assert(batch.size() == 11);
+    assert(batch.id[8] == 18);
+    assert(result.empty());
+    assert(sqlpp::fetch_columns(result, batch) == 0);
+  }
+
+  // Prepared statements
+  {
+    auto prepared = db.prepare(
+        select(foo.id, foo.blobN).from(foo).where(foo.id > parameter(foo.id)));
+    prepared.parameters.id = 15;
+    const auto batch = sqlpp::fetch_columns(db(prepared));
+    assert(batch.size() == 5);
+    assert(batch.id[4] == 20);
+    assert(batch.blobN.is_null(0));
+    assert(batch.blobN.data().empty());
+  }
+
+  return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace {
+struct foo_row {
+  int64_t id;
+  std::string textNnD;
+  std::optional<int64_t> intN;
+};
+
+SQLPP_CREATE_NAME_TAG(total);
+}  // namespace
+
+int FetchOne(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+
+  // Empty results
+  assert(not db.fetch_one(select(foo.id).from(foo).where(true)));
+  assert(not db.fetch_value(select(foo.id).from(foo).where(true)));
+
+  const auto blob = std::vector<uint8_t>{1, 2, 3};
+  db(insert_into(foo).set(foo.textNnD = "a", foo.intN = 7, foo.blobN = blob));
+  db(insert_into(foo).set(foo.textNnD = "b"));
+  db(insert_into(foo).set(foo.textNnD = "c", foo.intN = 3));
+
+  // Rows own their fields
+  {
+    const auto row =
+        db.fetch_one(select(foo.id, foo.textNnD, foo.intN, foo.blobN)
+                         .from(foo)
+                         .where(foo.id == 1));
+    assert(row);
+    static_assert(std::is_same_v<decltype(row->textNnD), std::string>);
+    assert(row->id == 1);
+    assert(row->textNnD == "a");
+    assert(row->intN == 7);
+    assert(row->blobN == blob);
+  }
+
+  // The first row only
+  {
+    const auto row = db.fetch_one(
+        select(foo.textNnD).from(foo).where(true).order_by(foo.id.desc()));
+    assert(row and row->textNnD == "c");
+  }
+
+  // Without a limit, `LIMIT 1` is added, which SQLite requires for an offset.
+  {
+    const auto row = db.fetch_one(
+        select(foo.textNnD).from(foo).where(true).order_by(foo.id.asc()).offset(
+            1u));
+    assert(row and row->textNnD == "b");
+  }
+
+  // An explicit limit is kept
+  {
+    const auto row = db.fetch_one(
+        select(foo.id).from(foo).where(true).order_by(foo.id.asc()).limit(2u));
+    assert(row and row->id == 1);
+  }
+
+  // Aggregates
+  {
+    const auto row = db.fetch_one<foo_row>(
+        select(foo.id, foo.textNnD, foo.intN).from(foo).where(foo.id == 2));
+    assert(row);
+    assert(row->textNnD == "b");
+    assert(row->intN == std::nullopt);
+  }
+
+  // Values, which are optional themselves if they can be NULL
+  {
+    const auto text =
+        db.fetch_value(select(foo.textNnD).from(foo).where(foo.id == 3));
+    assert(text == "c");
+
+    const auto sum_of_int =
+        db.fetch_value(select(sum(foo.intN).as(total)).from(foo).where(true));
+    static_assert(std::is_same_v<decltype(sum_of_int),
+                                 const std::optional<std::optional<int64_t>>>);
+    assert(sum_of_int and *sum_of_int == 10);
+
+    const auto missing =
+        db.fetch_value(select(foo.intN).from(foo).where(foo.id == 2));
+    assert(missing and not missing->has_value());
+  }
+
+  // Prepared statements
+  {
+    auto prepared = db.prepare(
+        select(foo.textNnD).from(foo).where(foo.id == parameter(foo.id)));
+    for (int64_t id = 1; id <= 4; ++id) {
+      prepared.parameters.id = id;
+      const auto text = db.fetch_value(prepared);
+      assert(text.has_value() == (id <= 3));
+    }
+    prepared.parameters.id = 2;
+    const auto row = db.fetch_one(prepared);
+    assert(row and row->textNnD == "b");
+  }
+
+  return 0;
+}
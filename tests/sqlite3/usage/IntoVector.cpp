@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace {
+struct foo_row {
+  int64_t id;
+  std::string textNnD;
+  std::optional<int64_t> intN;
+  std::optional<std::vector<uint8_t>> blobN;
+  // Not selected
+  int extra = 17;
+};
+
+SQLPP_CREATE_NAME_TAG(total);
+
+struct total_row {
+  std::string textNnD;
+  std::optional<int64_t> total;
+};
+}  // namespace
+
+int IntoVector(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+
+  const auto blob = std::vector<uint8_t>{1, 2, 3};
+  db(insert_into(foo).set(foo.textNnD = "a", foo.intN = 7, foo.blobN = blob));
+  db(insert_into(foo).set(foo.textNnD = "b"));
+  db(insert_into(foo).set(foo.textNnD = "b", foo.intN = 3));
+
+  {
+    const auto rows = db(select(foo.id, foo.textNnD, foo.intN, foo.blobN)
+                             .from(foo)
+                             .where(true))
+                          .into_vector<foo_row>();
+    assert(rows.size() == 3);
+    assert(rows[0].id == 1);
+    assert(rows[0].textNnD == "a");
+    assert(rows[0].intN == 7);
+    assert(rows[0].blobN == blob);
+    assert(rows[0].extra == 17);
+    assert(rows[1].textNnD == "b");
+    assert(rows[1].intN == std::nullopt);
+    assert(rows[1].blobN == std::nullopt);
+    assert(rows[2].id == 3);
+  }
+
+  // Aliased columns, the remaining rows of a result
+  {
+    auto result = db(select(foo.textNnD, sum(foo.id).as(total))
+                         .from(foo)
+                         .where(true)
+                         .group_by(foo.textNnD)
+                         .order_by(foo.textNnD.asc()));
+    assert(result.front().textNnD == "a");
+    result.pop_front();
+    const auto rows = result.into_vector<total_row>();
+    assert(rows.size() == 1);
+    assert(rows[0].textNnD == "b");
+    assert(rows[0].total == 5);
+    assert(result.empty());
+  }
+
+  // Prepared statements
+  {
+    auto prepared = db.prepare(
+        select(foo.id, foo.textNnD, foo.intN, foo.blobN)
+            .from(foo)
+            .where(foo.textNnD == parameter(foo.textNnD)));
+    prepared.parameters.textNnD = "b";
+    assert(db(prepared).into_vector<foo_row>().size() == 2);
+    prepared.parameters.textNnD = "c";
+    assert(db(prepared).into_vector<foo_row>().empty());
+  }
+
+  return 0;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+SQLPP_CREATE_NAME_TAG(twice);
+
+int LazyRows(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+
+  for (int i = 1; i <= 10; ++i) {
+    db(insert_into(foo).set(foo.textNnD = std::to_string(i),
+                            foo.intN = i % 2 ? std::optional<int>{i}
+                                             : std::nullopt));
+  }
+
+  // Fields are read when accessed
+  {
+    int64_t id = 0;
+    for (const auto& row :
+         db(select(all_of(foo)).from(foo).where(true)).lazy()) {
+      assert(row.get(foo.id) == ++id);
+      if (id % 3 == 0) {
+        assert(row.get(foo.textNnD) == std::to_string(id));
+        assert(row.get(foo.intN).has_value() == (id % 2 == 1));
+      }
+      // Repeated access returns the same field
+      assert(&row.get(foo.id) == &row.get(foo.id));
+    }
+    assert(id == 10);
+  }
+
+  // Aliases and complete rows
+  {
+    auto rows = db(select(foo.id, (foo.id * 2).as(twice), foo.textNnD)
+                       .from(foo)
+                       .where(foo.id > 8))
+                    .lazy();
+    assert(not rows.empty());
+    assert(rows.front().get(twice) == 18);
+    rows.pop_front();
+    assert(rows.front().get(twice) == 20);
+    const auto& row = rows.front().row();
+    assert(row.id == 10);
+    assert(row.twice == 20);
+    assert(row.textNnD == "10");
+    rows.pop_front();
+    assert(rows.empty());
+  }
+
+  // Empty results
+  {
+    auto rows = db(select(foo.id).from(foo).where(false)).lazy();
+    assert(rows.empty());
+    assert(rows.begin() == rows.end());
+  }
+
+  return 0;
+}
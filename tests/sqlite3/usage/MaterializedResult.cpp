@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int MaterializedResult(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+
+  const auto blob = std::vector<uint8_t>{1, 2, 3};
+  for (int i = 0; i < 100; ++i) {
+    db(insert_into(foo).set(foo.textNnD = std::string(i, 'x'),
+                            foo.blobN = i % 2 == 0 ? std::make_optional(blob)
+                                                   : std::nullopt));
+  }
+
+  auto make_rows = [&](std::size_t chunk_size) {
+    auto result =
+        db(select(foo.id, foo.textNnD, foo.blobN).from(foo).where(true));
+    // The current row is part of the materialized result.
+    return result.materialize(chunk_size);
+  };
+
+  {
+    // The text fields need 4950 bytes, the blobs 150.
+    const auto rows = make_rows(1024);
+    assert(rows.size() == 100);
+    assert(rows.arena_capacity() >= 5100);
+    assert(rows.arena_capacity() <= 8 * 1024);
+    int64_t id = 0;
+    for (const auto& row : rows) {
+      ++id;
+      assert(row);
+      assert(row.id == id);
+      assert(row.textNnD == std::string(id - 1, 'x'));
+      assert(row.blobN.has_value() == (id % 2 == 1));
+      if (row.blobN) {
+        assert(std::ranges::equal(*row.blobN, blob));
+      }
+    }
+    // Consecutive fields share a chunk.
+    assert(rows[2].textNnD.data() == rows[1].textNnD.data() + 1);
+  }
+
+  // Values larger than the chunk size get a chunk of their own
+  {
+    const auto rows = make_rows(16);
+    assert(rows.back().textNnD == std::string(99, 'x'));
+  }
+
+  // Prepared statements, the remaining rows
+  {
+    auto prepared = db.prepare(select(foo.textNnD).from(foo).where(
+        foo.id > parameter(foo.id)));
+    prepared.parameters.id = 97;
+    auto result = db(prepared);
+    result.pop_front();
+    const auto rows = result.materialize();
+    assert(rows.size() == 2);
+    assert(rows.front().textNnD == std::string(98, 'x'));
+    assert(result.empty());
+  }
+
+  return 0;
+}
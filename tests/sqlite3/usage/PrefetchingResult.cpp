@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int PrefetchingResult(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+
+  {
+    auto tx = start_transaction(db);
+    for (int i = 0; i < 1000; ++i) {
+      db(insert_into(foo).set(foo.textNnD = std::to_string(i + 1)));
+    }
+    tx.commit();
+  }
+
+  {
+    auto rows = sqlpp::prefetching_result{
+        db(select(foo.id, foo.textNnD).from(foo).where(true)), 64, 2};
+    int64_t id = 0;
+    for (const auto& row : rows) {
+      assert(row.id == ++id);
+      assert(row.textNnD == std::to_string(id));
+    }
+    assert(id == 1000);
+    assert(rows.empty());
+  }
+
+  // Function-based access
+  {
+    auto rows = sqlpp::prefetching_result{
+        db(select(foo.id).from(foo).where(foo.id > 995))};
+    auto ids = std::vector<int64_t>{};
+    while (not rows.empty()) {
+      ids.push_back(rows.front().id);
+      rows.pop_front();
+    }
+    assert((ids == std::vector<int64_t>{996, 997, 998, 999, 1000}));
+  }
+
+  // Stopping early
+  {
+    auto rows = sqlpp::prefetching_result{
+        db(select(foo.id).from(foo).where(true)), 10, 1};
+    assert(rows.front().id == 1);
+  }
+
+  // Rows read before an error are handed out before the error is rethrown.
+  // abs() fails with an integer overflow for the smallest integer, i.e. when
+  // reaching id 100.
+  {
+    auto rows = sqlpp::prefetching_result{
+        db(select(foo.id).from(foo).where(sqlpp::verbatim<sqlpp::boolean>(
+            "abs(-9223372036854775708 - id) > 0"))),
+        64, 2};
+    int64_t id = 0;
+    const auto read_all = [&] {
+      for (const auto& row : rows) {
+        assert(row.id == ++id);
+      }
+    };
+    assert_throw(read_all(), sql::exception);
+    assert(id == 99);
+  }
+
+  // Empty results
+  {
+    auto rows = sqlpp::prefetching_result{
+        db(select(foo.id).from(foo).where(false))};
+    assert(rows.empty());
+    assert(rows.begin() == rows.end());
+  }
+
+  return 0;
+}
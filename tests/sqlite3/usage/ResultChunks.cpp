@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <future>
+#include <numeric>
+#include <ranges>
+#include <thread>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int ResultChunks(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+
+  for (int i = 0; i < 100; ++i) {
+    db(insert_into(foo).set(foo.textNnD = std::to_string(i + 1)));
+  }
+  auto select_all = [&] {
+    return db(select(foo.id, foo.textNnD).from(foo).where(true));
+  };
+
+  {
+    auto result = select_all();
+    static_assert(std::ranges::input_range<decltype(result.chunks(10))>);
+    auto sizes = std::vector<std::size_t>{};
+    for (const auto& chunk : result.chunks(30)) {
+      sizes.push_back(chunk.size());
+      static_assert(std::ranges::contiguous_range<decltype(chunk.rows())>);
+    }
+    assert((sizes == std::vector<std::size_t>{30, 30, 30, 10}));
+    assert(result.empty());
+  }
+
+  // Process chunks on other threads while reading the next chunk.
+  {
+    auto sums = std::vector<std::future<int64_t>>{};
+    for (auto& chunk : select_all().chunks(7, 3)) {
+      sums.push_back(std::async(
+          std::launch::async, [chunk = std::move(chunk)]() -> int64_t {
+            return std::accumulate(
+                chunk.begin(), chunk.end(), int64_t{0},
+                [](int64_t sum, const auto& row) {
+                  // Text fields stay valid while the chunk exists.
+                  assert(row.textNnD == std::to_string(row.id));
+                  return sum + row.id;
+                });
+          }));
+    }
+    auto total = int64_t{0};
+    for (auto& sum : sums) {
+      total += sum.get();
+    }
+    assert(total == 5050);
+  }
+
+  // At most max_in_flight chunks exist at any time.
+  {
+    auto chunks = select_all().chunks(10, 2);
+    auto kept = std::vector<std::decay_t<decltype(*chunks.begin())>>{};
+    auto released = std::atomic<bool>{false};
+    auto releaser = std::jthread{};
+    for (auto& chunk : chunks) {
+      if (kept.size() == 2) {
+        assert(released);
+        break;
+      }
+      kept.push_back(std::move(chunk));
+      if (kept.size() == 2) {
+        releaser = std::jthread{[&] {
+          std::this_thread::sleep_for(std::chrono::milliseconds{20});
+          released = true;
+          kept.front() = {};
+        }};
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <source_location>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace {
+std::shared_ptr<sql::connection_config> make_config(std::string path,
+                                                    int flags) {
+  auto config = std::make_shared<sql::connection_config>();
+  config->path_to_database = std::move(path);
+  config->flags = flags | SQLITE_OPEN_URI;
+  config->debug = sql::get_debug_logger();
+  return config;
+}
+
+template <typename Db>
+void create_database(Db& db, std::string_view text) {
+  const auto foo = test::TabFoo{};
+  test::createTabFoo(db);
+  db(insert_into(foo).set(foo.textNnD = text));
+}
+}  // namespace
+
+int RoutingPool(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  const auto flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
+  auto pool = sql::routing_pool{
+      make_config("file:routing_primary?mode=memory&cache=shared", flags),
+      {
+          // Cannot be opened.
+          make_config("file:/sqlpp23/nonexistent/replica.db",
+                      SQLITE_OPEN_READWRITE),
+          make_config("file:routing_replica_1?mode=memory&cache=shared",
+                      flags),
+          make_config("file:routing_replica_2?mode=memory&cache=shared",
+                      flags),
+      },
+      sqlpp::routing_pool_options{.eviction_time = std::chrono::minutes{1}}};
+
+  // The idle connections in the pools keep the in-memory databases alive.
+  {
+    auto db = pool.get_primary();
+    create_database(db.connection(), "primary");
+  }
+  {
+    auto db = pool.replica(1).get();
+    create_database(db, "replica 1");
+  }
+  {
+    auto db = pool.replica(2).get();
+    create_database(db, "replica 2");
+  }
+
+  // Selects go to a replica. The broken replica is evicted on the way.
+  {
+    auto result = pool(select(foo.textNnD).from(foo).where(true));
+    assert(result.is_replica());
+    assert(result.front().textNnD.starts_with("replica"));
+  }
+
+  // Outstanding requests are balanced across replicas.
+  {
+    auto db1 = pool.get_replica();
+    auto db2 = pool.get_replica();
+    assert(db1.is_replica() and db2.is_replica());
+    const auto s = select(foo.textNnD).from(foo).where(true);
+    assert(db1(s).front().textNnD != db2(s).front().textNnD);
+  }
+
+  // Everything else goes to the primary.
+  pool(insert_into(foo).set(foo.textNnD = "primary"));
+  pool(update(foo).set(foo.intN = 7).where(true));
+  {
+    auto db = pool.get_primary();
+    assert(not db.is_replica());
+    auto rows = 0;
+    for (const auto& row :
+         db(select(foo.textNnD, foo.intN).from(foo).where(true))) {
+      assert(row.textNnD == "primary");
+      assert(row.intN == 7);
+      ++rows;
+    }
+    assert(rows == 2);
+  }
+
+  // Without available replicas, selects go to the primary.
+  for (auto i = 0; i < 2; ++i) {
+    auto db = pool.get_replica();
+    assert(db.is_replica());
+    pool.evict(db);
+  }
+  {
+    auto result = pool(select(foo.textNnD).from(foo).where(true));
+    assert(not result.is_replica());
+    assert(result.front().textNnD == "primary");
+  }
+
+  // A busy replica is not evicted.
+  {
+    auto busy = sql::routing_pool{
+        make_config("file:routing_busy_primary?mode=memory&cache=shared",
+                    flags),
+        {make_config("file:routing_busy_replica?mode=memory&cache=shared",
+                     flags)},
+        sqlpp::routing_pool_options{
+            .replica = {.max_size = 1,
+                        .acquire_timeout = std::chrono::milliseconds{10},
+                        .checkout_check = sqlpp::connection_check::ping}}};
+    {
+      auto db = busy.get_replica();
+      assert(db.is_replica());
+      assert_throw(busy.get_replica(), sqlpp::connection_pool_timeout);
+    }
+    assert(busy.get_replica().is_replica());
+  }
+
+  // Call sites are recorded at the caller of the routing pool.
+  {
+    auto tracked = sql::routing_pool{
+        make_config("file:routing_tracked_primary?mode=memory&cache=shared",
+                    flags),
+        {},
+        sqlpp::routing_pool_options{.primary = {.track_call_sites = true}}};
+    create_database(tracked.get_primary().connection(), "primary");
+    tracked(update(foo).set(foo.intN = 1).where(true));
+    const auto line = std::source_location::current().line() - 1;
+    const auto sites = tracked.primary().call_sites();
+    assert(sites.size() == 2);
+    assert(std::ranges::any_of(sites, [&](const auto& site) {
+      return site.location.line() == line and
+             std::string_view{site.location.file_name()}.ends_with(
+                 "RoutingPool.cpp");
+    }));
+  }
+
+  return 0;
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <source_location>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int ShardedPool(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  auto configs = std::vector<std::shared_ptr<const sql::connection_config>>{};
+  for (const auto* path : {"file:shard_0?mode=memory&cache=shared",
+                           "file:shard_1?mode=memory&cache=shared",
+                           "file:shard_2?mode=memory&cache=shared"}) {
+    auto config = std::make_shared<sql::connection_config>();
+    config->path_to_database = path;
+    config->flags =
+        SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_URI;
+    config->debug = sql::get_debug_logger();
+    configs.push_back(config);
+  }
+
+  // Tenants below 100 live in shard 0, below 200 in shard 1, others in shard 2.
+  auto pool =
+      sql::sharded_pool<>{configs, sqlpp::range_sharding<int64_t>({100, 200})};
+  assert(pool.shard_count() == 3);
+  assert(pool.shard_of(5) == 0);
+  assert(pool.shard_of(100) == 1);
+  assert(pool.shard_of(199) == 1);
+  assert(pool.shard_of(1000) == 2);
+
+  // Two bounds are meant for three shards.
+  {
+    auto too_few = sql::sharded_pool<>{
+        {configs[0], configs[1]}, sqlpp::range_sharding<int64_t>({100, 200})};
+    assert(too_few.shard_of(150) == 1);
+    assert_throw(too_few.shard_of(200), std::out_of_range);
+  }
+
+  // The idle connections in the pools keep the in-memory databases alive.
+  for (std::size_t i = 0; i < pool.shard_count(); ++i) {
+    auto db = pool.shard(i).get();
+    test::createTabFoo(db);
+  }
+  for (const int64_t tenant : {150, 5, 250, 199, 50, 1000}) {
+    pool.get(tenant)(insert_into(foo).set(foo.intN = tenant));
+  }
+  {
+    auto rows = 0;
+    for (const auto& row :
+         pool.get(150)(select(foo.intN).from(foo).where(true))) {
+      assert(row.intN >= 100 and row.intN < 200);
+      ++rows;
+    }
+    assert(rows == 2);
+  }
+
+  // A check can be given explicitly instead of the shard's checkout_check.
+  {
+    auto db = pool.get(1000, sqlpp::connection_check::ping);
+    assert(db(select(foo.intN).from(foo).where(true)).front().intN >= 200);
+  }
+
+  // Scatter-gather without order: all rows, one shard after the other.
+  {
+    auto result = pool.scatter(select(foo.intN).from(foo).where(true));
+    auto sum = int64_t{0};
+    auto rows = 0;
+    for (const auto& row : result) {
+      sum += row.intN.value();
+      ++rows;
+    }
+    assert(rows == 6);
+    assert(sum == 150 + 5 + 250 + 199 + 50 + 1000);
+  }
+
+  // Scatter-gather with a k-way merge of the ordered results.
+  {
+    auto result = pool.scatter(
+        select(foo.intN).from(foo).where(true).order_by(foo.intN.desc()),
+        [](const auto& lhs, const auto& rhs) { return lhs.intN > rhs.intN; });
+    auto values = std::vector<int64_t>{};
+    for (const auto& row : result) {
+      values.push_back(row.intN.value());
+    }
+    assert((values == std::vector<int64_t>{1000, 250, 199, 150, 50, 5}));
+  }
+
+  // Empty results are fine.
+  {
+    auto result = pool.scatter(
+        select(foo.intN).from(foo).where(foo.intN < 0).order_by(foo.intN.asc()),
+        [](const auto& lhs, const auto& rhs) { return lhs.intN < rhs.intN; });
+    assert(result.empty());
+    assert(result.begin() == result.end());
+  }
+
+  // Call sites are recorded at the caller of scatter.
+  {
+    auto tracked = sql::sharded_pool<>{
+        configs, sqlpp::connection_pool_options{.track_call_sites = true}};
+    auto result = tracked.scatter(select(foo.intN).from(foo).where(true));
+    const auto line = std::source_location::current().line() - 1;
+    for (std::size_t i = 0; i < tracked.shard_count(); ++i) {
+      const auto sites = tracked.shard(i).call_sites();
+      assert(sites.size() == 1);
+      assert(sites.front().location.line() == line);
+      assert(sites.front().in_use == 1);
+    }
+  }
+
+  return 0;
+}
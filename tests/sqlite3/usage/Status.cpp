@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int Status(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+  for (int i = 0; i < 100; ++i) {
+    db(insert_into(foo).set(foo.intN = i, foo.textNnD = "status"));
+  }
+
+  // No index on int_n: This is a full table scan.
+  auto scan = db.prepare(
+      select(foo.id).from(foo).where(foo.intN == parameter(foo.intN)));
+  assert(db.status(scan).runs == 0);
+  scan.parameters.intN = 7;
+  for (const auto& row : db(scan)) {
+    assert(row.id == 8);
+  }
+
+  auto status = db.status(scan);
+  assert(status.sql.find("int_n") != std::string::npos);
+  assert(status.runs == 1);
+  assert(status.fullscan_steps >= 99);
+  assert(status.vm_steps > 0);
+
+  // Reset returns the values before resetting.
+  assert(db.status(scan, true).runs == 1);
+  assert(db.status(scan).runs == 0);
+  assert(db.status(scan).fullscan_steps == 0);
+
+  // Lookup by primary key, no scan.
+  auto lookup =
+      db.prepare(select(foo.id).from(foo).where(foo.id == parameter(foo.id)));
+  lookup.parameters.id = 17;
+  assert(db(lookup).front().id == 17);
+  assert(db.status(lookup).fullscan_steps == 0);
+
+  // Both prepared statements are listed for the connection.
+  const auto statuses = db.statement_statuses();
+  assert(statuses.size() == 2);
+  for (const auto& s : statuses) {
+    assert(s.sql == db.status(scan).sql or s.sql == db.status(lookup).sql);
+  }
+
+  // Connection counters.
+  const auto db_status = db.status();
+  assert(db_status.cache_used > 0);
+  assert(db_status.schema_used > 0);
+  assert(db_status.statements_used > 0);
+  db.status(true);
+  assert(db.status().cache_hits == 0);
+
+  return 0;
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cmath>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace {
+SQLPP_CREATE_NAME_TAG(result);
+
+template <typename Db, typename Statement>
+size_t count_rows(Db& db, const Statement& statement) {
+  size_t rows = 0;
+  for (const auto& row : db(statement)) {
+    std::ignore = row;
+    ++rows;
+  }
+  return rows;
+}
+
+struct median {
+  std::vector<double> values;
+
+  void step(double value) { values.push_back(value); }
+
+  std::optional<double> result() {
+    if (values.empty()) {
+      return std::nullopt;
+    }
+    std::ranges::sort(values);
+    const auto middle = values.size() / 2;
+    return values.size() % 2 ? values[middle]
+                             : (values[middle - 1] + values[middle]) / 2;
+  }
+};
+
+struct failing_aggregate {
+  void step(int64_t) { throw 17; }
+  int64_t result() const { throw 17; }
+};
+}  // namespace
+
+int UserDefinedFunction(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+  for (int i = 1; i <= 10; ++i) {
+    db(insert_into(foo).set(foo.intN = i, foo.doubleN = i * 1.5,
+                            foo.textNnD = std::string(i, 'x')));
+  }
+  db(insert_into(foo).set(foo.textNnD = "null"));
+
+  // Scalar functions can be used in where conditions.
+  const auto distance = db.register_function(
+      "distance", [](double x, double y) { return std::hypot(x, y); }, true);
+  static_assert(std::is_same_v<sqlpp::data_type_of_t<decltype(distance(
+                                   foo.doubleN, foo.intN))>,
+                               std::optional<sqlpp::floating_point>>);
+  size_t rows = 0;
+  for (const auto& row :
+       db(select(foo.intN).from(foo).where(distance(foo.doubleN, foo.intN) <
+                                           10.0))) {
+    assert(row.intN.value() <= 5);
+    ++rows;
+  }
+  assert(rows == 5);
+
+  // NULL yields NULL, unless the argument is optional.
+  const auto is_missing = db.register_function(
+      "is_missing", [](std::optional<int64_t> x) { return not x.has_value(); });
+  assert(count_rows(db, select(foo.id).from(foo).where(is_missing(foo.intN))) ==
+         1);
+  assert(
+      not db(select(distance(foo.doubleN, 1).as(result)).from(foo).where(
+                 foo.intN.is_null()))
+              .front()
+              .result.has_value());
+
+  // Text and parameters.
+  const auto text_length = db.register_function(
+      "text_length",
+      [](std::string_view s) { return static_cast<int64_t>(s.size()); });
+  auto prepared = db.prepare(select(foo.intN).from(foo).where(
+      text_length(foo.textNnD) == parameter(foo.intN)));
+  prepared.parameters.intN = 7;
+  assert(db(prepared).front().intN == 7);
+
+  // Exceptions are reported as SQL errors.
+  const auto fail = db.register_function("fail", [](int64_t) -> int64_t {
+    throw std::runtime_error("fail");
+  });
+  assert_throw(db(select(fail(foo.id).as(result)).from(foo)), sql::exception);
+
+  // Also those that are not derived from std::exception.
+  const auto fail_badly = db.register_function(
+      "fail_badly", [](int64_t) -> int64_t { throw 17; });
+  assert_throw(db(select(fail_badly(foo.id).as(result)).from(foo)),
+               sql::exception);
+  const auto fail_badly_of =
+      db.register_aggregate("fail_badly_of", failing_aggregate{});
+  assert_throw(db(select(fail_badly_of(foo.id).as(result)).from(foo)),
+               sql::exception);
+
+  // Aggregate functions.
+  const auto median_of = db.register_aggregate("median_of", median{});
+  assert(db(select(median_of(foo.doubleN).as(result)).from(foo))
+             .front()
+             .result == 8.25);
+  assert(not db(select(median_of(foo.doubleN).as(result))
+                    .from(foo)
+                    .where(foo.id < 0))
+                 .front()
+                 .result.has_value());
+
+  return 0;
+}